@@ -0,0 +1,123 @@
+/*! \file bench_fused.cpp
+ *  \brief Measures the processing cost per sample of the fused receiver pipeline.
+ *
+ *  This file is used to compare the fused_receiver, which runs the overlay blocks as one
+ *  inlined call chain, with the receiver_chain in its different schedules. The same noisy
+ *  frames are run through each of them in chunks and the average number of TSC cycles
+ *  and nanoseconds of wall time per sample are printed along with the packet count.
+ *
+ *  The receiver_chain also runs the underlay_decode block, which the fused_receiver does
+ *  not, so its numbers include the underlay detection when it runs on the caller's core.
+ */
+
+#include <iostream>
+#include <chrono>
+#include <cstring>
+#include <x86intrin.h>
+#include <boost/program_options.hpp>
+#include "frame_builder.h"
+#include "receiver_chain.h"
+#include "fused_receiver.h"
+#include "underlay.h"
+
+using namespace wno;
+
+std::vector<std::complex<double> > build_samples(Rate rate, int num_frames);
+template<typename Receiver> int run(Receiver * receiver, const std::vector<std::complex<double> > & samples, int chunk_size);
+template<typename Receiver> void measure(const char * name, Receiver * receiver, const std::vector<std::complex<double> > & samples, int chunk_size, int num_frames);
+
+int main(int argc, char * argv[]){
+
+    namespace po = boost::program_options;
+    po::options_description desc("Allowed options");
+    desc.add_options()
+        ("help", "produce help message")
+        ("rate", po::value<int>()->default_value(RATE_3_4_QAM16), "phy rate of the frames (0 - 10)")
+        ("frames", po::value<int>()->default_value(20), "number of frames")
+        ("chunk-size", po::value<int>()->default_value(4096), "number of samples per call to process_samples()")
+        ("decode-workers", po::value<int>()->default_value(0), "number of frame decoding threads of the receiver_chain")
+    ;
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if(vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    int num_frames = vm["frames"].as<int>();
+    int chunk_size = vm["chunk-size"].as<int>();
+    int decode_workers = vm["decode-workers"].as<int>();
+    std::vector<std::complex<double> > samples = build_samples(Rate(vm["rate"].as<int>()), num_frames);
+
+    printf("\n  pipeline          | cycles / sample | ns / sample | packets\n");
+    measure("fused", new fused_receiver(), samples, chunk_size, num_frames);
+    measure("lock-step", new receiver_chain(chain_params(false, LOCK_STEP, 4, 0, NULL, WAIT_BLOCK, DEFAULT_SPIN_COUNT, decode_workers)), samples, chunk_size, num_frames);
+    measure("depth-first", new receiver_chain(chain_params(false, DEPTH_FIRST, 4, 0, NULL, WAIT_BLOCK, DEFAULT_SPIN_COUNT, decode_workers)), samples, chunk_size, num_frames);
+    measure("pipelined", new receiver_chain(chain_params(false, PIPELINED, 4, 0, NULL, WAIT_BLOCK, DEFAULT_SPIN_COUNT, decode_workers)), samples, chunk_size, num_frames);
+
+    return 0;
+}
+
+/*!
+ *  Builds num_frames noisy frames back to back, followed by enough silence to flush a
+ *  lock-step chain.
+ */
+std::vector<std::complex<double> > build_samples(Rate rate, int num_frames)
+{
+    frame_builder * fb = new frame_builder();
+
+    std::string data("This is a test string. Beware! it might not reach destination............");
+    int repeat = 50;
+    std::vector<unsigned char> payload(data.length()*repeat);
+    for(int x = 0; x < repeat; x++) memcpy(&payload[x*data.length()], &data[0], data.length());
+
+    std::vector<std::complex<double> > frame = fb->build_frame(payload, rate);
+    noise_injector receiver_noise;
+    receiver_noise.add_noise(frame);
+
+    std::vector<std::complex<double> > samples(frame.size() * num_frames + 8 * 4096, 0);
+    for(int x = 0; x < num_frames; x++)
+    {
+        memcpy(&samples[x*frame.size()], &frame[0], frame.size() * sizeof(std::complex<double>));
+    }
+
+    delete fb;
+    return samples;
+}
+
+/*!
+ *  Feeds the samples to a receiver in chunks, flushes it and returns the number of packets
+ *  received.
+ */
+template<typename Receiver>
+int run(Receiver * receiver, const std::vector<std::complex<double> > & samples, int chunk_size)
+{
+    int count = 0;
+    for(int x = 0; x < samples.size(); x += chunk_size)
+    {
+        int end = std::min(x + chunk_size, (int)samples.size());
+        std::vector<std::complex<double> > chunk(samples.begin() + x, samples.begin() + end);
+        count += receiver->process_samples(chunk).size();
+    }
+    return count + receiver->flush().size();
+}
+
+/*!
+ *  Times one run of the samples through a receiver and prints the cost per sample.
+ */
+template<typename Receiver>
+void measure(const char * name, Receiver * receiver, const std::vector<std::complex<double> > & samples, int chunk_size, int num_frames)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    unsigned long long start_tsc = __rdtsc();
+
+    int count = run(receiver, samples, chunk_size);
+
+    unsigned long long cycles = __rdtsc() - start_tsc;
+    double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    printf("  %-17s | %15.1f | %11.1f | %3i / %i\n", name, (double)cycles / samples.size(), elapsed / samples.size(), count, num_frames);
+}
@@ -0,0 +1,147 @@
+/*! \file bench_handoff.cpp
+ *  \brief Measures the latency of handing work from one thread to another.
+ *
+ *  This file is used to compare the wait strategies of the handoff class that the
+ *  receiver chain uses between its block threads. Two threads pass a token back and
+ *  forth and the average time per handoff is printed for each strategy.
+ */
+
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <pthread.h>
+#include <semaphore.h>
+#include <boost/program_options.hpp>
+#include "handoff.h"
+
+using namespace wno;
+
+double ping_pong_sem(int iterations, int ping_cpu, int pong_cpu);
+double ping_pong(wait_strategy strategy, int spin_count, int iterations, int ping_cpu, int pong_cpu);
+void pin_thread(int cpu);
+
+int main(int argc, char * argv[]){
+
+    namespace po = boost::program_options;
+    po::options_description desc("Allowed options");
+    desc.add_options()
+        ("help", "produce help message")
+        ("iterations", po::value<int>()->default_value(20000), "number of round trips per strategy")
+        ("spin-count", po::value<int>()->default_value(DEFAULT_SPIN_COUNT), "polls before a spin-then-block wait blocks")
+        ("ping-cpu", po::value<int>()->default_value(-1), "core to pin the first thread to (-1 for none)")
+        ("pong-cpu", po::value<int>()->default_value(-1), "core to pin the second thread to (-1 for none)")
+    ;
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if(vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    int iterations = vm["iterations"].as<int>();
+    int spin_count = vm["spin-count"].as<int>();
+    int ping_cpu = vm["ping-cpu"].as<int>();
+    int pong_cpu = vm["pong-cpu"].as<int>();
+
+    printf("\n  strategy          | ns / handoff\n");
+    printf("  sem_t             | %12.0f\n", ping_pong_sem(iterations, ping_cpu, pong_cpu));
+    printf("  block             | %12.0f\n", ping_pong(WAIT_BLOCK, spin_count, iterations, ping_cpu, pong_cpu));
+    printf("  spin then block   | %12.0f\n", ping_pong(WAIT_SPIN_THEN_BLOCK, spin_count, iterations, ping_cpu, pong_cpu));
+
+    // Two polling threads sharing a core only make progress when the scheduler preempts one of them
+    if(std::thread::hardware_concurrency() < 2 || (ping_cpu >= 0 && ping_cpu == pong_cpu))
+    {
+        printf("  busy poll         |      skipped (needs two cores)\n");
+    }
+    else
+    {
+        printf("  busy poll         | %12.0f\n", ping_pong(WAIT_BUSY_POLL, spin_count, iterations, ping_cpu, pong_cpu));
+    }
+
+    return 0;
+}
+
+/*!
+ *  Pins the calling thread to a core (does nothing for a negative core).
+ */
+void pin_thread(int cpu)
+{
+    if(cpu < 0) return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if(pthread_setaffinity_np(pthread_self(), sizeof(set), &set))
+    {
+        std::cout << "Could not pin thread to core " << cpu << std::endl;
+    }
+}
+
+/*!
+ *  Passes a token back and forth between two threads through a pair of handoffs and
+ *  returns the average time per handoff in nanoseconds.
+ */
+double ping_pong(wait_strategy strategy, int spin_count, int iterations, int ping_cpu, int pong_cpu)
+{
+    handoff ping(strategy, spin_count);
+    handoff pong(strategy, spin_count);
+
+    std::thread other([&]()
+    {
+        pin_thread(pong_cpu);
+        for(int x = 0; x < iterations; x++)
+        {
+            ping.wait();
+            pong.post();
+        }
+    });
+
+    pin_thread(ping_cpu);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(int x = 0; x < iterations; x++)
+    {
+        ping.post();
+        pong.wait();
+    }
+    double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    other.join();
+
+    return elapsed / (2.0 * iterations);
+}
+
+/*!
+ *  Same as ping_pong() with plain semaphores, as used by the receiver chain before the
+ *  handoff class.
+ */
+double ping_pong_sem(int iterations, int ping_cpu, int pong_cpu)
+{
+    sem_t ping, pong;
+    sem_init(&ping, 0, 0);
+    sem_init(&pong, 0, 0);
+
+    std::thread other([&]()
+    {
+        pin_thread(pong_cpu);
+        for(int x = 0; x < iterations; x++)
+        {
+            sem_wait(&ping);
+            sem_post(&pong);
+        }
+    });
+
+    pin_thread(ping_cpu);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(int x = 0; x < iterations; x++)
+    {
+        sem_post(&ping);
+        sem_wait(&pong);
+    }
+    double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    other.join();
+
+    sem_destroy(&ping);
+    sem_destroy(&pong);
+    return elapsed / (2.0 * iterations);
+}
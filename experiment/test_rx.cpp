@@ -15,7 +15,7 @@ using namespace wno;
 
 void test_rx(double freq, double sample_rate, double rx_gain);
 void test_rx_pause(double freq, double rate, double rx_gain);
-void process_packets_callback(std::vector<std::vector<unsigned char> > packets);
+void process_packets_callback(std::vector<rx_packet> & packets);
 bool set_realtime_priority();
 
 double freq = 5.72e9;
@@ -47,8 +47,8 @@ int main(int argc, char * argv[]){
  *
  *  This function creates a receiver object which spawns its own thread for the receiver chain.
  *  It passes a pointer to the  #process_packets_callback() function which is used to process
- *  the received packets (in this case it just counts them). This function then proceeds to spin
- *  forever in a while(1) loop until the user kills the program externally (preferably by using
+ *  the received packets (in this case it just counts them). This function then proceeds to print
+ *  the capture ring statistics every second forever until the user kills the program externally (preferably by using
  *  something like Ctrl+c or the kill command in the shell, however, while not suggested,
  *  pulling the power plug does also effectively kill the program).
  */
@@ -60,9 +60,19 @@ void test_rx(double freq, double sample_rate, double rx_gain)
     // Instantiate a usrp
     printf("Instantiating the usrp.\n");
 
-    receiver rx = receiver(&process_packets_callback, freq, sample_rate, rx_gain, "");
+    receiver rx(&process_packets_callback, freq, sample_rate, rx_gain, "");
+    printf("Receiver buffers: %zu KB\n", rx.buffer_footprint() / 1024);
 
-    while(1);
+    // Report how far the processing lags behind the capture once per second
+    while(1)
+    {
+        sleep(1);
+
+        capture_stats stats = rx.capture_statistics();
+        rx.reset_capture_high_water();
+        printf("Captured %llu chunks, dropped %llu, radio overflows %llu, high water %zu / %zu chunks\n", (unsigned long long)stats.chunks_captured,
+               (unsigned long long)stats.chunks_dropped, (unsigned long long)stats.radio_overflows, stats.high_water, stats.capacity);
+    }
 }
 
 
@@ -84,7 +94,7 @@ void test_rx_pause(double freq, double sample_rate, double rx_gain)
 
     // Instantiate a usrp
     printf("Instantiating the usrp.\n");
-    receiver rx = receiver(&process_packets_callback, freq, sample_rate, rx_gain, "");
+    receiver rx(&process_packets_callback, freq, sample_rate, rx_gain, "");
 
     while(1)
     {
@@ -107,16 +117,18 @@ void test_rx_pause(double freq, double sample_rate, double rx_gain)
  * \param packets The successfully received packets in from the receiver_chain
  *
  *  This function merely counts the number of received packets and prints the timestamps
- *  of when the packets were received.
+ *  of when the packets were received, along with where the last one was found in the stream.
  */
-void process_packets_callback(std::vector<std::vector<unsigned char> > packets)
+void process_packets_callback(std::vector<rx_packet> & packets)
 {
     rx_count += packets.size();
 
     boost::posix_time::ptime rx_time = boost::posix_time::microsec_clock::local_time();
     if(packets.size() > 0)
     {
-        std::cout << "Received " << rx_count << " packets at " << rx_time.time_of_day() << std::endl;
+        std::cout << "Received " << rx_count << " packets at " << rx_time.time_of_day()
+                  << ", last one at sample " << packets.back().stamp.index << " (device time " << packets.back().stamp.time << " s)"
+                  << ", RSSI " << packets.back().rssi << " dB, SNR " << packets.back().snr << " dB" << std::endl;
     }
 
 }
@@ -6,16 +6,30 @@
  */
 
 #include <iostream>
+#include <random>
+#include <chrono>
+#include <thread>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/date_time/gregorian/gregorian.hpp>
 #include <boost/program_options.hpp>
 #include "usrp.h"
 #include "frame_builder.h"
 #include "receiver_chain.h"
+#include "block_graph.h"
+#include "underlay.h"
 
 using namespace wno;
 
-void test_sim();
+#define SIM_SAMPLE_RATE 5e6 // Sample rate the simulated chunks are stamped with
+
+void test_sim(chain_params params);
+void test_graph(std::string chain, chain_params params);
+std::vector<std::complex<double> > build_sim_samples();
+void benchmark_sic(Rate rate, int num_frames, double snr_min, double snr_max, chain_params params);
+void benchmark_latency(int num_frames, chain_params params);
+void print_underlay_events(receiver_chain * receiver);
+void print_underlay_events(underlay_decode * decoder);
+void print_packets(const std::vector<rx_packet> & rec_frames);
 
 double freq = 5.26e9;
 double sample_rate = 5e6;
@@ -29,8 +43,88 @@ Rate phy_rate = RATE_3_4_QAM16;
 
 int main(int argc, char * argv[]){
 
+    namespace po = boost::program_options;
+    po::options_description desc("Allowed options");
+    desc.add_options()
+        ("help", "produce help message")
+        ("sic-benchmark", "compare the packet yield with and without underlay cancellation")
+        ("latency-benchmark", "measure the packet latency and throughput of the receiver chain")
+        ("rate", po::value<int>()->default_value(RATE_3_4_QAM64), "phy rate of the benchmark frames (0 - 10)")
+        ("frames", po::value<int>()->default_value(20), "number of frames per benchmark point")
+        ("snr-min", po::value<double>()->default_value(20), "lowest benchmark SNR in dB")
+        ("snr-max", po::value<double>()->default_value(32), "highest benchmark SNR in dB")
+        ("schedule", po::value<std::string>()->default_value("lock-step"), "how the receiver blocks run (lock-step, pipelined, work-stealing or depth-first)")
+        ("workers", po::value<int>()->default_value(0), "number of work-stealing workers, 0 for one per core")
+        ("decode-workers", po::value<int>()->default_value(DEFAULT_DECODE_WORKERS), "number of frame decoding threads, 0 to decode in the frame_decoder thread")
+        ("wait", po::value<std::string>()->default_value("block"), "how the block threads wait (block, spin or poll)")
+        ("chain", po::value<std::string>()->default_value("full"), "blocks of the simulated receiver (full, overlay or underlay), the last two are built as a block_graph")
+    ;
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if(vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    chain_params params;
+    std::string schedule = vm["schedule"].as<std::string>();
+    if(schedule == "pipelined") params.schedule = PIPELINED;
+    else if(schedule == "work-stealing") params.schedule = WORK_STEALING;
+    else if(schedule == "depth-first") params.schedule = DEPTH_FIRST;
+    else if(schedule != "lock-step")
+    {
+        std::cout << "Unknown schedule " << schedule << std::endl;
+        return 1;
+    }
+    params.num_workers = vm["workers"].as<int>();
+    params.decode_workers = vm["decode-workers"].as<int>();
+
+    std::string wait = vm["wait"].as<std::string>();
+    if(wait == "spin") params.wait = WAIT_SPIN_THEN_BLOCK;
+    else if(wait == "poll") params.wait = WAIT_BUSY_POLL;
+    else if(wait != "block")
+    {
+        std::cout << "Unknown wait strategy " << wait << std::endl;
+        return 1;
+    }
+
+    if(vm.count("sic-benchmark"))
+    {
+        std::cout << "Running SIC Benchmark..." << std::endl;
+        benchmark_sic(Rate(vm["rate"].as<int>()), vm["frames"].as<int>(), vm["snr-min"].as<double>(), vm["snr-max"].as<double>(), params);
+        return 0;
+    }
+
+    if(vm.count("latency-benchmark"))
+    {
+        std::cout << "Running Latency Benchmark..." << std::endl;
+        benchmark_latency(vm["frames"].as<int>(), params);
+        return 0;
+    }
+
+    std::string chain = vm["chain"].as<std::string>();
+    if(chain != "full")
+    {
+        if(chain != "overlay" && chain != "underlay")
+        {
+            std::cout << "Unknown chain " << chain << std::endl;
+            return 1;
+        }
+        if(params.schedule != PIPELINED && params.schedule != DEPTH_FIRST)
+        {
+            std::cout << "The " << chain << " chain needs the pipelined or depth-first schedule" << std::endl;
+            return 1;
+        }
+        std::cout << "Running Simulation..." << std::endl;
+        test_graph(chain, params);
+        return 0;
+    }
+
     std::cout << "Running Simulation..." << std::endl;
-    test_sim();
+    test_sim(params);
 
     return 0;
 }
@@ -40,11 +134,111 @@ int main(int argc, char * argv[]){
  *  This function builds some packets using the frame builder and sends them through
  *  the receiver chain.  This function does NOT use the transmitter and receiver classes.
  */
-void test_sim()
+void test_sim(chain_params params)
+{
+    receiver_chain * receiver = new receiver_chain(params);
+    std::vector<std::complex<double> > samples_con = build_sim_samples();
+
+    boost::posix_time::ptime start = boost::posix_time::microsec_clock::local_time();
+
+    // Run the samples through the receiver chain
+
+    int chunk_size = 4096;
+
+    int count = 0;
+    for(int x = 0; x < samples_con.size(); x += chunk_size)
+    {
+        int start = x;
+        int end = x + chunk_size;
+        if(end > samples_con.size()) end = samples_con.size();
+        std::vector<std::complex<double> > chunk(&samples_con[start], &samples_con[end]);
+
+        // Stamped as if captured at the default sample rate from device time 0
+        std::vector<rx_packet> rec_frames = receiver->process_samples(chunk, sample_stamp(start, start / SIM_SAMPLE_RATE), SIM_SAMPLE_RATE);
+        count += rec_frames.size();
+        print_underlay_events(receiver);
+        print_packets(rec_frames);
+    }
+
+    // Wait for the samples still in the chain
+    std::vector<rx_packet> rec_frames = receiver->flush();
+    count += rec_frames.size();
+    print_packets(rec_frames);
+
+    boost::posix_time::time_duration elapsed = boost::posix_time::microsec_clock::local_time() - start;
+
+    print_underlay_events(receiver);
+    printf("Received %i packets\n", count);
+
+    printf("Time elapsed: %f\n", elapsed.total_microseconds() / 1000.0);
+}
+
+/*!
+ *  Same as test_sim() with a receiver built as a block_graph of only the overlay blocks
+ *  or only the underlay_decode block. Both branches are added to the graph and the one
+ *  that is not needed is disabled.
+ */
+void test_graph(std::string chain, chain_params params)
 {
+    typedef block_graph<std::complex<double>, rx_packet> receiver_graph;
+    receiver_graph * graph = new receiver_graph(params.schedule, params.ring_depth, params.wait, params.spin_count);
+
+    underlay_decode * ul_decoder = new underlay_decode();
+    int decoder = graph->add(ul_decoder);
+    graph->connect_input(decoder);
 
+    int detector = graph->add(new frame_detector());
+    int sync = graph->add(new timing_sync());
+    int fft = graph->add(new fft_symbols());
+    int chan = graph->add(new channel_est());
+    int phase = graph->add(new phase_tracker());
+    int frames = graph->add(new frame_decoder(params.decode_workers));
+    graph->connect_input(detector);
+    graph->connect(detector, sync);
+    graph->connect(sync, fft);
+    graph->connect(fft, chan);
+    graph->connect(chan, phase);
+    graph->connect(phase, frames);
+    graph->connect_output(frames);
+
+    graph->set_enabled(decoder, chain == "underlay");
+    graph->set_enabled(detector, chain == "overlay");
+    graph->start();
+
+    std::vector<std::complex<double> > samples_con = build_sim_samples();
+    boost::posix_time::ptime start = boost::posix_time::microsec_clock::local_time();
+
+    int chunk_size = 4096;
+    int count = 0;
+    for(int x = 0; x < samples_con.size(); x += chunk_size)
+    {
+        int end = std::min(x + chunk_size, (int)samples_con.size());
+        std::vector<std::complex<double> > chunk(&samples_con[x], &samples_con[end]);
+
+        std::vector<rx_packet> rec_frames = graph->process(chunk);
+        count += rec_frames.size();
+        print_underlay_events(ul_decoder);
+        print_packets(rec_frames);
+    }
+
+    std::vector<rx_packet> rec_frames = graph->flush();
+    count += rec_frames.size();
+    print_packets(rec_frames);
+
+    boost::posix_time::time_duration elapsed = boost::posix_time::microsec_clock::local_time() - start;
+
+    print_underlay_events(ul_decoder);
+    printf("Received %i packets\n", count);
+
+    printf("Time elapsed: %f\n", elapsed.total_microseconds() / 1000.0);
+}
+
+/*!
+ *  Builds the samples of the simulation: ten copies of a noisy frame back to back.
+ */
+std::vector<std::complex<double> > build_sim_samples()
+{
     frame_builder * fb = new frame_builder();
-    receiver_chain * receiver = new receiver_chain();
 
     // Generate the data
     std::string data("This is a test string. Beware! it might not reach destination............");
@@ -57,6 +251,10 @@ void test_sim()
     // Build a frame
     std::vector<std::complex<double>> samples = fb->build_frame(payload, phy_rate);
 
+    // Add the simulated receiver noise
+    noise_injector receiver_noise;
+    receiver_noise.add_noise(samples);
+
     int pad_length = 0;//samples.size()*1000;
 
     // Concatenate num_frames frames together
@@ -73,35 +271,221 @@ void test_sim()
     memcpy(&samples_con[num_frames*samples.size()], &zeros[0], zeros.size()*sizeof(std::complex<double>));
     std::cout << samples_con.size() << std::endl;
 
-    boost::posix_time::ptime start = boost::posix_time::microsec_clock::local_time();
+    delete fb;
+    return samples_con;
+}
 
-    // Run the samples through the receiver chain
 
-    int chunk_size = 4096;
+/*!
+ *  Prints the received payloads, each preceded by the sample index and time of its frame's STS
+ *  and the frame's reception metrics.
+ */
+void print_packets(const std::vector<rx_packet> & rec_frames)
+{
+    for(int i = 0; i < rec_frames.size(); i++){
+        const rx_packet & p = rec_frames[i];
+        std::cout << "[STS at sample " << p.stamp.index << ", " << p.stamp.time << " s] "
+                  << "[RSSI " << p.rssi << " dB, CFO " << p.cfo << " rad/sample, SNR " << p.snr << " dB, EVM " << p.evm
+                  << ", rate " << p.rate << ", " << p.length << " bytes, path metric " << p.path_metric << "] ";
+        for(int j = 0; j < rec_frames[i].payload.size(); j++)
+            std::cout << rec_frames[i].payload[j];
+        std::cout << std::endl << std::endl;
+    }
+}
 
+/*!
+ *  Prints the underlay bits detected by the receiver chain so far.
+ */
+void print_underlay_events(receiver_chain * receiver)
+{
+    underlay_event event;
+    while(receiver->poll_underlay_event(event))
+    {
+        printf("underlay [%i] %lld %f bit %i %s ber %llu/%llu\n", event.code, (long long)event.index, event.coeff, event.bit,
+               event.locked ? "locked" : "searching", (unsigned long long)event.bits_in_error, (unsigned long long)event.bits);
+    }
+}
+
+/*!
+ *  Prints the underlay bits detected by an underlay_decode block so far.
+ */
+void print_underlay_events(underlay_decode * decoder)
+{
+    underlay_event event;
+    while(decoder->poll_event(event))
+    {
+        printf("underlay [%i] %lld %f bit %i %s ber %llu/%llu\n", event.code, (long long)event.index, event.coeff, event.bit,
+               event.locked ? "locked" : "searching", (unsigned long long)event.bits_in_error, (unsigned long long)event.bits);
+    }
+}
+
+/*!
+ *  Runs the received samples through the receiver chain in chunks and returns the number
+ *  of packets received. If arrivals is not NULL the number of samples fed to the chain
+ *  when each packet came out is appended to it.
+ */
+int run_chain(receiver_chain * receiver, const std::vector<std::complex<double> > & samples, std::vector<int> * arrivals = NULL)
+{
+    int chunk_size = 4096;
     int count = 0;
-    for(int x = 0; x < samples_con.size(); x += chunk_size)
+    for(int x = 0; x < samples.size(); x += chunk_size)
     {
-        int start = x;
-        int end = x + chunk_size;
-        if(end > samples_con.size()) end = samples_con.size();
-        std::vector<std::complex<double> > chunk(&samples_con[start], &samples_con[end]);
+        int end = std::min(x + chunk_size, (int)samples.size());
+        std::vector<std::complex<double> > chunk(&samples[x], &samples[end]);
+        int received = receiver->process_samples(chunk).size();
+        if(arrivals) arrivals->insert(arrivals->end(), received, end);
+        count += received;
+    }
+    int flushed = receiver->flush().size();
+    if(arrivals) arrivals->insert(arrivals->end(), flushed, (int)samples.size());
+    return count + flushed;
+}
 
-        std::vector<std::vector<unsigned char> > rec_frames = receiver->process_samples(chunk);
-        count += rec_frames.size();
+/*!
+ *  Returns the mean number of samples fed past the end of each frame before its packet
+ *  came out, as text. Packets are matched to frames in order, so the lag is only given
+ *  when every frame was received.
+ */
+std::string lag(const std::vector<int> & arrivals, int num_frames, int frame_size)
+{
+    if(arrivals.size() != num_frames) return "      -";
+    double sum = 0;
+    for(int x = 0; x < num_frames; x++) sum += arrivals[x] - (x + 1) * frame_size;
+    char text[64];
+    snprintf(text, sizeof(text), "%7.0f (%.2f ms)", sum / num_frames, sum / num_frames / sample_rate * 1e3);
+    return text;
+}
+
+/*!
+ *  This function builds num_frames frames at the given rate (with the underlay added by the
+ *  frame builder) and adds white gaussian noise at each SNR between snr_min and snr_max.
+ *  The same noisy samples are then sent through a receiver chain without and with underlay
+ *  cancellation and the number of packets received by each is printed. The SNR is measured
+ *  against the power of the transmitted samples, underlay included.
+ *
+ *  The canceller holds the overlay samples back until the underlay periods they overlap
+ *  are decided, so the packets come out later with SIC. The lag columns show how many
+ *  samples past the end of its frame each chain was fed on average before a packet came out.
+ *
+ *  The two chains are built once and reused for every SNR, the silence after the frames
+ *  and the flush leave them idle between the points.
+ */
+void benchmark_sic(Rate rate, int num_frames, double snr_min, double snr_max, chain_params params)
+{
+    frame_builder * fb = new frame_builder();
+
+    std::string data("This is a test string. Beware! it might not reach destination............");
+    int repeat = 50;
+    std::vector<unsigned char> payload(data.length()*repeat);
+    for(int x = 0; x < repeat; x++) memcpy(&payload[x*data.length()], &data[0], data.length());
 
-        if(rec_frames.size()){
-            for(int i = 0; i < rec_frames.size(); i++){
-                for(int j = 0; j < rec_frames[i].size(); j++)
-                    std::cout << rec_frames[i][j];
-                std::cout << std::endl << std::endl;
-            }
+    std::vector<std::complex<double> > frame = fb->build_frame(payload, rate);
+    delete fb;
+    noise_injector receiver_noise;
+    receiver_noise.add_noise(frame);
+
+    double power = 0;
+    for(int x = 0; x < frame.size(); x++) power += std::norm(frame[x]);
+    power /= frame.size();
+
+    // Frames followed by enough silence to flush the delayed overlay path
+    int flush_length = 4 * 4096;
+    std::vector<std::complex<double> > clean(frame.size() * num_frames + flush_length, 0);
+    for(int x = 0; x < num_frames; x++)
+    {
+        memcpy(&clean[x*frame.size()], &frame[0], frame.size() * sizeof(std::complex<double>));
+    }
+
+    params.cancel_underlay = false;
+    receiver_chain * without_canceller = new receiver_chain(params);
+    params.cancel_underlay = true;
+    receiver_chain * with_canceller = new receiver_chain(params);
+
+    printf("\n  SNR (dB) | without SIC | with SIC | lag without SIC | lag with SIC\n");
+    std::default_random_engine generator(1);
+    for(double snr = snr_min; snr <= snr_max; snr += 2)
+    {
+        std::normal_distribution<double> noise(0, std::sqrt(power / std::pow(10, snr / 10) / 2));
+        std::vector<std::complex<double> > samples(clean.size());
+        for(int x = 0; x < clean.size(); x++)
+        {
+            samples[x] = clean[x] + std::complex<double>(noise(generator), noise(generator));
         }
+
+        std::vector<int> without_arrivals, with_arrivals;
+        int without_sic = run_chain(without_canceller, samples, &without_arrivals);
+        int with_sic = run_chain(with_canceller, samples, &with_arrivals);
+        printf("  %8.1f | %5i / %-3i | %5i / %-3i | %-15s | %s\n", snr, without_sic, num_frames, with_sic, num_frames,
+               lag(without_arrivals, num_frames, frame.size()).c_str(), lag(with_arrivals, num_frames, frame.size()).c_str());
     }
+}
 
-    boost::posix_time::time_duration elapsed = boost::posix_time::microsec_clock::local_time() - start;
 
-    printf("Received %i packets\n", count);
+/*!
+ *  Measures how long the packets take to come out of the receiver chain.
+ *
+ *  The samples are first run through the chain as fast as possible to measure its throughput.
+ *  They are then passed to a second chain in chunks paced at the sample rate, as the usrp
+ *  block would deliver them, and the latency of each packet is measured from the time its
+ *  frame's last sample arrived to the time the packet was returned. Packets are matched
+ *  to frames in order, so the latencies are only meaningful if every frame is received.
+ *  Both runs use the same chain, which the flush and the trailing silence leave idle.
+ */
+void benchmark_latency(int num_frames, chain_params params)
+{
+    typedef std::chrono::steady_clock clock;
 
-    printf("Time elapsed: %f\n", elapsed.total_microseconds() / 1000.0);
+    frame_builder * fb = new frame_builder();
+
+    std::string data("This is a test string. Beware! it might not reach destination............");
+    int repeat = 50;
+    std::vector<unsigned char> payload(data.length()*repeat);
+    for(int x = 0; x < repeat; x++) memcpy(&payload[x*data.length()], &data[0], data.length());
+
+    std::vector<std::complex<double> > frame = fb->build_frame(payload, phy_rate);
+    delete fb;
+    noise_injector receiver_noise;
+    receiver_noise.add_noise(frame);
+
+    // Frames followed by enough silence to flush a lock-step chain
+    int chunk_size = 4096;
+    std::vector<std::complex<double> > samples(frame.size() * num_frames + 8 * chunk_size, 0);
+    for(int x = 0; x < num_frames; x++)
+    {
+        memcpy(&samples[x*frame.size()], &frame[0], frame.size() * sizeof(std::complex<double>));
+    }
+
+    receiver_chain * receiver = new receiver_chain(params);
+
+    clock::time_point start = clock::now();
+    int count = run_chain(receiver, samples);
+    double elapsed = std::chrono::duration<double>(clock::now() - start).count();
+    printf("Throughput: %.2f Msps (%i / %i packets)\n", samples.size() / elapsed / 1e6, count, num_frames);
+
+    std::vector<double> latency;
+    start = clock::now();
+    for(int x = 0; x < samples.size(); x += chunk_size)
+    {
+        int end = std::min(x + chunk_size, (int)samples.size());
+        std::this_thread::sleep_until(start + std::chrono::nanoseconds((long long)(end / sample_rate * 1e9)));
+
+        std::vector<std::complex<double> > chunk(&samples[x], &samples[end]);
+        int received = receiver->process_samples(chunk).size();
+        double now = std::chrono::duration<double>(clock::now() - start).count();
+        for(int p = 0; p < received; p++)
+        {
+            double arrival = (latency.size() + 1) * frame.size() / sample_rate;
+            latency.push_back(now - arrival);
+        }
+    }
+    receiver->flush();
+
+    double sum = 0, max = 0;
+    for(int x = 0; x < latency.size(); x++)
+    {
+        sum += latency[x];
+        max = std::max(max, latency[x]);
+    }
+    if(latency.size()) printf("Latency: mean %.3f ms, max %.3f ms (%i / %i packets)\n", sum / latency.size() * 1e3, max * 1e3, (int)latency.size(), num_frames);
+    else printf("Latency: no packets received\n");
 }
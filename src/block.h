@@ -10,22 +10,59 @@
 #define BLOCK_H
 
 /*! \def BUFFER_MAX
- *  \brief Maximum buffer size of for the input & output buffers
+ *  \brief Default maximum number of samples per chunk
  *
- *  Techinically each block uses the
- * ~~~{.cpp}
- * std::vector::reserve(size_type n)
- * ~~~
- * function to reserve BUFFER_MAX * sizeof(size_type) bytes
+ *  Each block sizes its input & output buffers for the most items it can get and produce
+ *  per chunk (see block::max_input and block::max_output), by default for chunks of
+ *  BUFFER_MAX samples. A receiver_chain passes its chain_params::max_chunk on instead.
  */
 
 #define BUFFER_MAX 65536
 
+/*! \def MAX_SYMBOLS
+ *  \brief Maximum number of OFDM symbols completed from a chunk of samples
+ *
+ *  At most one 64 sample symbol per 64 samples (the two LTS symbols share one CP) plus the
+ *  symbols that were in progress.
+ */
+
+#define MAX_SYMBOLS(samples) ((samples) / 64 + 2)
+
+/*! \def SYMBOL_BUFFER_MAX
+ *  \brief Default maximum number of OFDM symbols per chunk, i.e. the symbols of #BUFFER_MAX samples
+ */
+
+#define SYMBOL_BUFFER_MAX MAX_SYMBOLS(BUFFER_MAX)
+
 #include <vector>
 #include <string>
+#include <utility>
+
+#include "mirrored_ring.h"
+#include "tagged_vector.h"
 
 namespace wno
 {
+    /*!
+     * \brief Sink appending the items a block produces to a vector.
+     *
+     * Blocks implement their processing as a process(item, sink) member template that
+     * passes every item it produces to sink(item). Their work() function runs it over the
+     * input_buffer with a vector_sink on the output_buffer, while a fused_pipeline passes
+     * the items straight on to the next block's process().
+     */
+    template<typename T>
+    struct vector_sink
+    {
+        std::vector<T> & items; //!< The vector the items are appended to
+
+        vector_sink(std::vector<T> & _items) : items(_items) {} //!< Constructor for vector_sink
+
+        void operator()(const T & item) { items.push_back(item); } //!< Appends an item
+
+        void operator()(T && item) { items.push_back(std::move(item)); } //!< Appends an item without copying it
+    };
+
     /*!
      * \brief The block_base class.
      *
@@ -46,6 +83,8 @@ namespace wno
         {
         }
 
+        virtual ~block_base() {}
+
         /*!
          * \brief The main work function.
          *
@@ -53,6 +92,28 @@ namespace wno
          */
         virtual void work() = 0;
 
+        /*!
+         * \brief Called by the scheduler right before each call to work().
+         *
+         * Blocks that declared a history length append their new input to their
+         * history ring here, see block::input_window.
+         */
+        virtual void prepare() {}
+
+        /*!
+         * \brief Called by the scheduler once the input has run out.
+         *
+         * Blocks holding back output they could produce without further input put it in
+         * their output buffer here, as if from a call to work() without input.
+         */
+        virtual void finish() {}
+
+        /*!
+         * \brief Gets the number of bytes the block allocated for its chunks: its buffers at
+         *  their declared sizes, its history ring and any staging buffers of its own.
+         */
+        virtual size_t buffer_footprint() { return 0; }
+
         /*!
          * \brief the public name of the block
          */
@@ -73,14 +134,33 @@ namespace wno
         /*!
          * \brief constructor
          *
-         * Reserves BUFFER_MAX * sizeof(size_type) for the input and output buffers.
+         * Reserves max_input items for the input buffer and max_output items for the output buffer.
          * \param block_name the name of the block as a std::string
+         * \param max_input Most input items per call to work(), see #max_input.
+         * \param max_output Most output items per call to work(), see #max_output.
+         * \param history Number of previous input items the block needs in front of
+         *  each input (0 for none), see #input_window.
          */
-        block(std::string block_name) :
-            block_base(block_name)
+        block(std::string block_name, size_t max_input = BUFFER_MAX, size_t max_output = BUFFER_MAX, size_t history = 0) :
+            block_base(block_name),
+            input_window(NULL),
+            max_input(max_input),
+            max_output(max_output),
+            history_length(history),
+            m_history(history ? new mirrored_ring<I>(history, max_input) : NULL)
         {
-            input_buffer.reserve(BUFFER_MAX);
-            output_buffer.reserve(BUFFER_MAX);
+            input_buffer.reserve(max_input);
+            output_buffer.reserve(max_output);
+        }
+
+        virtual ~block() { delete m_history; }
+
+        /*!
+         * \brief Appends the input_buffer to the history ring and points #input_window at it.
+         */
+        virtual void prepare()
+        {
+            if(m_history) input_window = m_history->append(input_buffer.data(), input_buffer.size());
         }
 
         /*!
@@ -93,12 +173,20 @@ namespace wno
          */
         virtual void work() = 0;
 
+        /*!
+         * \brief Gets the bytes of both buffers at their declared sizes and of the history ring.
+         */
+        virtual size_t buffer_footprint()
+        {
+            return max_input * sizeof(I) + max_output * sizeof(O) + (m_history ? m_history->footprint() : 0);
+        }
+
         /*!
          * \brief input_buffer contains new input items to be consumed
          *
          * Contains new input items of type I. There is no guarantee on the number of items
-         * passed to the input_buffer for each call to work except that it must be less than
-         * #BUFFER_MAX.
+         * passed to the input_buffer for each call to work except that it must not exceed
+         * #max_input.
          */
         std::vector<I> input_buffer;
 
@@ -106,9 +194,139 @@ namespace wno
          * \brief output_buffer is where the output items of the block should be placed
          *
          * There is no restriction on the number of output items a block must produce on each call
-         * except that it must be less than #BUFFER_MAX.
+         * except that it must not exceed #max_output.
          */
         std::vector<O> output_buffer;
+
+        /*!
+         * \brief Tags of the input_buffer items, sorted by offset
+         *
+         * Passed along with the input_buffer. Only streams of samples carry tags, the
+         * frame_detector tags the start and end of the STS and the timing_sync the LTS.
+         */
+        std::vector<stream_tag> input_tags;
+
+        /*!
+         * \brief Tags of the output_buffer items, sorted by offset
+         *
+         * Blocks setting or passing on tags fill this along with the output_buffer.
+         */
+        std::vector<stream_tag> output_tags;
+
+        /*!
+         * \brief Contiguous view of the input including its history
+         *
+         * Set before each call to work() for blocks with a #history_length: the last
+         * #history_length input items of the previous calls (zeros at first) followed by a
+         * copy of the input_buffer. The view may be modified, the changes to the last
+         * #history_length items are seen by the next call.
+         */
+        I * input_window;
+
+        const size_t max_input; //!< Most input items per call to work(), the next block's max_input is this block's max_output
+
+        const size_t max_output; //!< Most output items per call to work() (the block's worst case for max_input items)
+
+        const size_t history_length; //!< Number of previous input items in front of #input_window
+
+    protected:
+
+        /*!
+         * \brief Appends items to the history ring without going through the input_buffer,
+         *  for blocks processing one item at a time.
+         * \param items The items to append.
+         * \param count Number of items.
+         * \return The view: #history_length previous items followed by the appended items.
+         */
+        I * append_history(const I * items, size_t count) { return m_history->append(items, count); }
+
+    private:
+
+        mirrored_ring<I> * m_history; //!< Ring holding the input history (NULL without history)
+    };
+
+    /*!
+     * \brief The tap class template.
+     *
+     * A tap is a block without an output that consumes the same input as another block
+     * in the receiver chain. Instead of owning an input buffer it points to the input_buffer
+     * of the block it is connected to, so the samples are neither copied nor delayed and
+     * both blocks can read them concurrently. A tap must not modify its input.
+     */
+    template<typename I>
+    class tap : public block_base
+    {
+    public:
+
+        /*!
+         * \brief constructor
+         * \param block_name the name of the tap as a std::string
+         * \param max_input Most input items per call to work(), see #max_input.
+         * \param history Number of previous input items the tap needs in front of
+         *  each input (0 for none), see #input_window.
+         */
+        tap(std::string block_name, size_t max_input = BUFFER_MAX, size_t history = 0) :
+            block_base(block_name),
+            input_buffer(NULL),
+            input_window(NULL),
+            max_input(max_input),
+            history_length(history),
+            m_history(history ? new mirrored_ring<I>(history, max_input) : NULL)
+        {
+        }
+
+        virtual ~tap() { delete m_history; }
+
+        /*!
+         * \brief Appends the tapped input to the history ring and points #input_window at it.
+         */
+        virtual void prepare()
+        {
+            if(m_history) input_window = m_history->append(input_buffer->data(), input_buffer->size());
+        }
+
+        /*!
+         * \brief The main work function.
+         *
+         * This function is purely virtual.
+         * This function must consume *input_buffer and carryover any items that it might need
+         * on its next call since the buffer will be overwritten.
+         */
+        virtual void work() = 0;
+
+        /*!
+         * \brief Connects the tap to the input buffer of another block.
+         * \param buffer The input_buffer of the block to tap.
+         */
+        void connect(const std::vector<I> & buffer) { input_buffer = &buffer; }
+
+        /*!
+         * \brief Gets the bytes of the history ring. The input buffer belongs to the tapped block.
+         */
+        virtual size_t buffer_footprint() { return m_history ? m_history->footprint() : 0; }
+
+        /*!
+         * \brief input_buffer points to the input items to be consumed
+         *
+         * Points to the input_buffer of the block the tap is connected to.
+         */
+        const std::vector<I> * input_buffer;
+
+        /*!
+         * \brief Contiguous view of the input including its history
+         *
+         * Same as block::input_window. The view is the tap's own copy, so unlike the
+         * input_buffer it may be modified.
+         */
+        I * input_window;
+
+        const size_t max_input; //!< Most input items per call to work()
+
+        const size_t history_length; //!< Number of previous input items in front of #input_window
+
+    private:
+
+        mirrored_ring<I> * m_history; //!< Ring holding the input history (NULL without history)
     };
 
 }
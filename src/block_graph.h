@@ -0,0 +1,445 @@
+/*! \file block_graph.h
+ *  \brief Header file for the block_graph class template.
+ *
+ *  The block_graph class connects receiver blocks at run time, so that each deployment
+ *  can build a chain of only the blocks it needs (e.g. overlay only or underlay only)
+ *  instead of the fixed chain of the receiver_chain class.
+ */
+
+#ifndef BLOCK_GRAPH_H
+#define BLOCK_GRAPH_H
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "block.h"
+#include "chunk_ring.h"
+#include "stage.h"
+
+namespace wno
+{
+    /*!
+     * \brief A block in a block_graph.
+     *
+     * Lets the block_graph handle its blocks and their rings through generic pointers
+     * even though they are different templates. The derived classes know the item types
+     * of the block's ports.
+     */
+    class graph_node
+    {
+    public:
+
+        /*!
+         * \brief graph_node constructor
+         * \param node_block The block.
+         */
+        graph_node(block_base * node_block) :
+            block(node_block),
+            upstream(-1),
+            is_input(false),
+            is_output(false),
+            enabled(true)
+        {
+        }
+
+        virtual ~graph_node() {}
+
+        virtual const std::type_info & input_type() = 0; //!< Get the type of the items the block consumes
+
+        virtual const std::type_info & output_type() = 0; //!< Get the type of the items the block produces
+
+        /*!
+         * \brief Creates a ring of the block's input items.
+         * \param depth Number of chunks the ring can hold.
+         * \param wait How the threads wait on the ring.
+         * \param spin_count Number of polls before blocking (WAIT_SPIN_THEN_BLOCK only).
+         */
+        virtual ring_base * make_ring(int depth, wait_strategy wait, int spin_count) = 0;
+
+        /*!
+         * \brief Creates the stage running the block.
+         * \param input Ring made by #make_ring().
+         * \param outputs Rings of the output items (none to drop the output).
+         */
+        virtual stage_base * make_stage(ring_base * input, const std::vector<ring_base *> & outputs) = 0;
+
+        block_base * block; //!< The block
+
+        int upstream; //!< Index of the node feeding this one (-1 if none)
+
+        bool is_input; //!< Whether the node is fed the graph input
+
+        bool is_output; //!< Whether the node's output is the graph output
+
+        bool enabled; //!< Whether the node (and every node fed by it) runs
+    };
+
+    /*!
+     * \brief Node of a block<I,O>.
+     */
+    template<typename I, typename O>
+    class block_node : public graph_node
+    {
+    public:
+
+        /*!
+         * \brief Constructor for block_node
+         * \param node_block The block.
+         */
+        block_node(wno::block<I,O> * node_block) :
+            graph_node(node_block),
+            m_block(node_block)
+        {
+        }
+
+        virtual const std::type_info & input_type() { return typeid(I); }
+
+        virtual const std::type_info & output_type() { return typeid(O); }
+
+        virtual ring_base * make_ring(int depth, wait_strategy wait, int spin_count)
+        {
+            return new chunk_ring<I>(depth, wait, spin_count);
+        }
+
+        virtual stage_base * make_stage(ring_base * input, const std::vector<ring_base *> & outputs)
+        {
+            chunk_ring<O> * output = outputs.empty() ? NULL : static_cast<chunk_ring<O> *>(outputs[0]);
+            block_stage<I,O> * stage = new block_stage<I,O>(m_block, static_cast<chunk_ring<I> *>(input), output);
+            for(int x = 1; x < outputs.size(); x++) stage->add_output(static_cast<chunk_ring<O> *>(outputs[x]));
+            return stage;
+        }
+
+    private:
+
+        wno::block<I,O> * m_block; //!< The block
+    };
+
+    /*!
+     * \brief Node of a tap<I>. The tap passes its input on, so its output items are its input items.
+     */
+    template<typename I>
+    class tap_node : public graph_node
+    {
+    public:
+
+        /*!
+         * \brief Constructor for tap_node
+         * \param node_tap The tap.
+         */
+        tap_node(tap<I> * node_tap) :
+            graph_node(node_tap),
+            m_tap(node_tap)
+        {
+        }
+
+        virtual const std::type_info & input_type() { return typeid(I); }
+
+        virtual const std::type_info & output_type() { return typeid(I); }
+
+        virtual ring_base * make_ring(int depth, wait_strategy wait, int spin_count)
+        {
+            return new chunk_ring<I>(depth, wait, spin_count);
+        }
+
+        virtual stage_base * make_stage(ring_base * input, const std::vector<ring_base *> & outputs)
+        {
+            chunk_ring<I> * output = outputs.empty() ? NULL : static_cast<chunk_ring<I> *>(outputs[0]);
+            tap_stage<I> * stage = new tap_stage<I>(m_tap, static_cast<chunk_ring<I> *>(input), output);
+            for(int x = 1; x < outputs.size(); x++) stage->add_output(static_cast<chunk_ring<I> *>(outputs[x]));
+            return stage;
+        }
+
+    private:
+
+        tap<I> * m_tap; //!< The tap
+    };
+
+    /*!
+     * \brief The block_graph class template.
+     *
+     * Inputs items of type I, e.g. the raw complex samples.
+     *
+     * Outputs items of type O, e.g. the received payloads.
+     *
+     * The blocks are added with #add(), which returns the index used to refer to the block
+     * when connecting it. #connect() feeds the output of one block to the input of another,
+     * #connect_input() feeds it the graph input and #connect_output() makes its output the
+     * graph output. Each block has one input, but its output may feed any number of blocks,
+     * which get a copy of each chunk. A tap passes its input on once it is done with it, so
+     * the blocks it feeds run strictly behind it. The item types of the two ends of every
+     * connection are checked when connecting, a mismatch throws std::invalid_argument.
+     *
+     * #set_enabled() turns a block off together with every block it feeds, so one graph
+     * can hold optional branches that are left out by deployments that do not need them.
+     * Blocks not reached from the graph input do not run.
+     *
+     * Once #start() is called the graph can no longer be changed. It runs the blocks over
+     * chunk_rings like the receiver_chain does in its PIPELINED (one thread per block) or
+     * DEPTH_FIRST (on the caller's thread) schedule. Like the receiver_chain the graph
+     * is not meant to be destroyed once started.
+     */
+    template<typename I, typename O>
+    class block_graph
+    {
+    public:
+
+        /*!
+         * \brief Constructor for block_graph
+         * \param schedule How the blocks are run, PIPELINED or DEPTH_FIRST.
+         * \param ring_depth Number of chunks each ring between two blocks can hold.
+         * \param wait How the block threads wait for their input and for room in their output.
+         * \param spin_count Number of polls before a WAIT_SPIN_THEN_BLOCK wait blocks.
+         */
+        block_graph(chain_schedule schedule = PIPELINED, int ring_depth = 4, wait_strategy wait = WAIT_BLOCK, int spin_count = DEFAULT_SPIN_COUNT) :
+            m_schedule(schedule),
+            m_ring_depth(ring_depth),
+            m_wait(wait),
+            m_spin_count(spin_count),
+            m_started(false),
+            m_output_ring(NULL)
+        {
+            if(schedule != PIPELINED && schedule != DEPTH_FIRST)
+            {
+                throw std::invalid_argument("block_graph: only the PIPELINED and DEPTH_FIRST schedules are supported");
+            }
+        }
+
+        /*!
+         * \brief Adds a block to the graph.
+         * \param new_block The block. The graph does not take ownership of it.
+         * \return The index of the block in the graph.
+         */
+        template<typename BI, typename BO>
+        int add(wno::block<BI,BO> * new_block) { return add_node(new block_node<BI,BO>(new_block)); }
+
+        /*!
+         * \brief Adds a tap to the graph.
+         * \param new_tap The tap. The graph does not take ownership of it.
+         * \return The index of the tap in the graph.
+         */
+        template<typename T>
+        int add(tap<T> * new_tap) { return add_node(new tap_node<T>(new_tap)); }
+
+        /*!
+         * \brief Feeds the output of a block to the input of another block.
+         * \param from Index of the block producing the items.
+         * \param to Index of the block consuming them. It must not be fed by anything yet.
+         */
+        void connect(int from, int to)
+        {
+            graph_node * source = node(from);
+            graph_node * sink = node(to);
+            check_unfed(sink);
+            if(source->output_type() != sink->input_type())
+            {
+                throw std::invalid_argument("block_graph: the output of " + source->block->name + " (" + source->output_type().name() +
+                                            ") does not match the input of " + sink->block->name + " (" + sink->input_type().name() + ")");
+            }
+            for(int x = from; x >= 0; x = m_nodes[x]->upstream)
+            {
+                if(x == to) throw std::invalid_argument("block_graph: connecting " + source->block->name + " to " + sink->block->name + " makes a loop");
+            }
+            sink->upstream = from;
+        }
+
+        /*!
+         * \brief Feeds the graph input to a block.
+         * \param to Index of the block. It must not be fed by anything yet.
+         */
+        void connect_input(int to)
+        {
+            graph_node * sink = node(to);
+            check_unfed(sink);
+            if(sink->input_type() != typeid(I))
+            {
+                throw std::invalid_argument("block_graph: the graph input (" + std::string(typeid(I).name()) +
+                                            ") does not match the input of " + sink->block->name + " (" + sink->input_type().name() + ")");
+            }
+            sink->is_input = true;
+        }
+
+        /*!
+         * \brief Makes the output of a block the graph output.
+         * \param from Index of the block. Only one block can be the graph output.
+         */
+        void connect_output(int from)
+        {
+            graph_node * source = node(from);
+            if(source->output_type() != typeid(O))
+            {
+                throw std::invalid_argument("block_graph: the output of " + source->block->name + " (" + source->output_type().name() +
+                                            ") does not match the graph output (" + typeid(O).name() + ")");
+            }
+            for(int x = 0; x < m_nodes.size(); x++)
+            {
+                if(m_nodes[x]->is_output) throw std::invalid_argument("block_graph: " + m_nodes[x]->block->name + " is already the graph output");
+            }
+            source->is_output = true;
+        }
+
+        /*!
+         * \brief Turns a block on or off. A block that is off does not run, and neither does
+         *  any block fed by it. Every block starts out on.
+         * \param index Index of the block.
+         * \param enabled Whether the block runs.
+         */
+        void set_enabled(int index, bool enabled) { node(index)->enabled = enabled; }
+
+        /*!
+         * \brief Builds the rings and stages of the blocks that run and starts their threads.
+         */
+        void start()
+        {
+            check_stopped();
+
+            // Order the blocks that run so that every block comes after the one feeding it
+            std::vector<int> order;
+            for(int x = 0; x < m_nodes.size(); x++) if(m_nodes[x]->is_input && m_nodes[x]->enabled) order.push_back(x);
+            for(int o = 0; o < order.size(); o++)
+            {
+                for(int x = 0; x < m_nodes.size(); x++) if(m_nodes[x]->upstream == order[o] && m_nodes[x]->enabled) order.push_back(x);
+            }
+
+            std::vector<ring_base *> rings(m_nodes.size(), (ring_base *)NULL);
+            for(int o = 0; o < order.size(); o++)
+            {
+                rings[order[o]] = m_nodes[order[o]]->make_ring(m_ring_depth, m_wait, m_spin_count);
+                if(m_nodes[order[o]]->is_input) m_input_rings.push_back(static_cast<chunk_ring<I> *>(rings[order[o]]));
+            }
+
+            // Sized so that the output block never waits for process() to collect its output
+            m_output_ring = new chunk_ring<O>((order.size() + 1) * (m_ring_depth + 1) + 1, m_wait, m_spin_count);
+
+            for(int o = 0; o < order.size(); o++)
+            {
+                std::vector<ring_base *> outputs;
+                for(int x = 0; x < m_nodes.size(); x++) if(m_nodes[x]->upstream == order[o] && rings[x]) outputs.push_back(rings[x]);
+                if(m_nodes[order[o]]->is_output) outputs.push_back(m_output_ring);
+                m_stages.push_back(m_nodes[order[o]]->make_stage(rings[order[o]], outputs));
+            }
+
+            m_started = true;
+            if(m_schedule == PIPELINED)
+            {
+                for(int x = 0; x < m_stages.size(); x++) m_threads.push_back(std::thread(run_stage, m_stages[x]));
+            }
+        }
+
+        /*!
+         * \brief Passes items to the blocks fed the graph input.
+         * \param items The input items.
+         * \return The output items produced since the previous call. In the DEPTH_FIRST
+         *  schedule these include all output items of the given input.
+         */
+        std::vector<O> process(std::vector<I> items)
+        {
+            if(!m_started) throw std::logic_error("block_graph: process() called before start()");
+
+            std::vector<O> output;
+            if(items.size())
+            {
+                for(int x = 0; x < m_input_rings.size(); x++)
+                {
+                    std::vector<I> chunk;
+                    if(x + 1 < m_input_rings.size()) chunk = items;
+                    else chunk.swap(items);
+                    while(!m_input_rings[x]->push(chunk)) m_input_rings[x]->wait_space();
+                }
+                if(m_schedule == DEPTH_FIRST) run_depth_first(m_stages);
+            }
+            collect(output);
+            return output;
+        }
+
+        /*!
+         * \brief Waits until the blocks have processed every item passed to #process() and
+         *  lets each block output what it holds back (see block_base::finish()).
+         * \return The output items produced since the previous call to #process().
+         */
+        std::vector<O> flush()
+        {
+            if(!m_started) throw std::logic_error("block_graph: flush() called before start()");
+
+            std::vector<O> output;
+            flush_stages(m_stages, [&]() { collect(output); }, [&](stage_base * stage)
+            {
+                if(m_schedule == DEPTH_FIRST) run_depth_first(m_stages);
+            });
+            return output;
+        }
+
+    private:
+
+        /*!
+         * \brief Adds a node, unless the graph was started.
+         * \return The index of the node.
+         */
+        int add_node(graph_node * new_node)
+        {
+            if(m_started)
+            {
+                delete new_node;
+                check_stopped();
+            }
+            m_nodes.push_back(new_node);
+            return m_nodes.size() - 1;
+        }
+
+        /*!
+         * \brief Gets a node for changing it.
+         * \param index Index of the node, checked to be valid.
+         */
+        graph_node * node(int index)
+        {
+            check_stopped();
+            if(index < 0 || index >= m_nodes.size()) throw std::out_of_range("block_graph: no block with index " + std::to_string(index));
+            return m_nodes[index];
+        }
+
+        /*!
+         * \brief Throws if the graph was started.
+         */
+        void check_stopped()
+        {
+            if(m_started) throw std::logic_error("block_graph: the graph cannot be changed once started");
+        }
+
+        /*!
+         * \brief Throws if the node's input is already fed by a block or the graph input.
+         */
+        void check_unfed(graph_node * sink)
+        {
+            if(sink->upstream >= 0 || sink->is_input) throw std::invalid_argument("block_graph: the input of " + sink->block->name + " is already connected");
+        }
+
+        /*!
+         * \brief Appends the items waiting in #m_output_ring to output.
+         */
+        void collect(std::vector<O> & output)
+        {
+            std::vector<O> chunk;
+            while(m_output_ring->pop(chunk))
+            {
+                for(int x = 0; x < chunk.size(); x++) output.push_back(std::move(chunk[x]));
+            }
+        }
+
+        chain_schedule m_schedule; //!< How the blocks are run
+        int m_ring_depth;          //!< Number of chunks each ring can hold
+        wait_strategy m_wait;      //!< How the threads wait on the rings
+        int m_spin_count;          //!< Polls before a WAIT_SPIN_THEN_BLOCK wait blocks
+        bool m_started;            //!< Whether #start() was called
+
+        std::vector<graph_node *> m_nodes;          //!< The blocks in the order they were added
+        std::vector<stage_base *> m_stages;         //!< Stages of the blocks that run, every stage after the one feeding it
+        std::vector<chunk_ring<I> *> m_input_rings; //!< Rings of the blocks fed the graph input
+        chunk_ring<O> * m_output_ring;              //!< Ring the output block delivers through
+        std::vector<std::thread> m_threads;         //!< One thread per stage (PIPELINED only)
+    };
+}
+
+#endif // BLOCK_GRAPH_H
@@ -0,0 +1,234 @@
+/*! \file capture_ring.h
+ *  \brief Ring of sample chunks between the capture thread and the processing thread.
+ *
+ *  The capture_ring class lets the thread reading samples from the USRP hand them to the
+ *  thread running the receiver chain without ever waiting for it, and keeps count of how
+ *  full the ring got and of the chunks it had to drop.
+ */
+
+#ifndef CAPTURE_RING_H
+#define CAPTURE_RING_H
+
+#include <atomic>
+#include <cmath>
+#include <complex>
+#include <vector>
+#include <stdint.h>
+
+#include "spsc_queue.h"
+#include "handoff.h"
+#include "tagged_vector.h"
+
+namespace wno
+{
+    /*!
+     * \brief Statistics of a capture_ring
+     */
+    struct capture_stats
+    {
+        uint64_t chunks_captured;   //!< Chunks received from the radio
+        uint64_t chunks_dropped;    //!< Chunks received while the ring was full (overflows)
+        uint64_t radio_overflows;   //!< Overflows the radio reported, i.e. samples lost before they reached the ring
+        size_t high_water;          //!< Most chunks waiting in the ring at once since the last reset
+        size_t capacity;            //!< Number of chunks the ring can hold
+        size_t chunk_size;          //!< Number of samples per chunk
+    };
+
+    /*!
+     * \brief The capture_ring class.
+     *
+     * A lock-free single producer single consumer ring of sample chunks. All chunks are
+     * allocated up front and recycled: the producer fills the chunk returned by
+     * #write_chunk() and publishes it with #publish(), which swaps it with the free slot.
+     * The producer never waits. If the consumer falls behind so far that the ring is full,
+     * the chunk is dropped and the producer reuses it for the next one, so the radio keeps
+     * being drained and the samples are lost here (and counted) instead of in the radio.
+     *
+     * Every chunk is stamped with the absolute index of its first sample, which counts the
+     * samples of the dropped chunks too, and the device time the producer got with it. A
+     * chunk may hold fewer samples than chunk_size if the radio returned early, the index
+     * only advances by the samples actually published. Samples the radio itself dropped are
+     * not seen here, so after an #overflow() the index is resynchronized from the device time
+     * of the next chunk that has one (given the sample rate).
+     */
+    class capture_ring
+    {
+    public:
+
+        /*!
+         * \brief Constructor for capture_ring
+         * \param num_chunks Minimum number of chunks the ring can hold.
+         * \param chunk_size Number of samples per chunk.
+         * \param strategy How the consumer waits when the ring is empty.
+         * \param spin_count Number of polls before blocking (WAIT_SPIN_THEN_BLOCK only).
+         */
+        capture_ring(size_t num_chunks, size_t chunk_size, wait_strategy strategy = WAIT_BLOCK, int spin_count = DEFAULT_SPIN_COUNT) :
+            m_chunks(num_chunks, slot(chunk_size)),
+            m_chunk(chunk_size),
+            m_chunk_size(chunk_size),
+            m_items(strategy, spin_count),
+            m_rate(0),
+            m_next_index(0),
+            m_reference_index(0),
+            m_reference_time(-1),
+            m_resync(false),
+            m_captured(0),
+            m_dropped(0),
+            m_overflows(0),
+            m_high_water(0)
+        {
+        }
+
+        /*!
+         * \brief Sets the sample rate the indices are resynchronized with after an overflow.
+         *  Must be called before the producer starts.
+         * \param rate Sample rate in samples per second, 0 if unknown (no resynchronization).
+         */
+        void set_sample_rate(double rate) { m_rate = rate; }
+
+        /*!
+         * \brief Gets the chunk to fill next. Producer thread only.
+         * \return A chunk of chunk_size samples.
+         */
+        std::vector<std::complex<double> > & write_chunk()
+        {
+            m_chunk.samples.resize(m_chunk_size);
+            return m_chunk.samples;
+        }
+
+        /*!
+         * \brief Publishes the first samples of the chunk returned by #write_chunk(). Producer
+         *  thread only.
+         * \param count Number of samples filled in, nothing is published if 0.
+         * \param time Device time of the chunk's first sample in seconds, negative if unknown.
+         * \return False if the ring was full and the chunk was dropped.
+         */
+        bool publish(size_t count, double time = -1)
+        {
+            if(count == 0) return true;
+
+            uint64_t index = m_next_index;
+            if(time >= 0)
+            {
+                if(m_resync && m_reference_time >= 0 && m_rate > 0)
+                {
+                    int64_t gap = llround((time - m_reference_time) * m_rate) - (int64_t)(m_next_index - m_reference_index);
+                    if(gap > 0) index += gap;
+                    m_resync = false;
+                }
+                if(m_reference_time < 0)
+                {
+                    m_reference_index = index;
+                    m_reference_time = time;
+                }
+            }
+            m_next_index = index + count;
+
+            m_captured.fetch_add(1, std::memory_order_relaxed);
+            m_chunk.samples.resize(count);
+            m_chunk.stamp = sample_stamp(index, time);
+            if(!m_chunks.push_swap(m_chunk))
+            {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            size_t waiting = m_chunks.size();
+            if(waiting > m_high_water.load(std::memory_order_relaxed)) m_high_water.store(waiting, std::memory_order_relaxed);
+            m_items.post();
+            return true;
+        }
+
+        /*!
+         * \brief Removes the oldest chunk from the ring. Consumer thread only.
+         * \param chunk Set to the removed chunk. Its previous storage goes back to the ring.
+         * \param stamp Set to the stamp of the chunk's first sample.
+         * \return False if the ring was empty.
+         */
+        bool pop(std::vector<std::complex<double> > & chunk, sample_stamp & stamp)
+        {
+            m_pop.samples.swap(chunk);
+            bool popped = m_chunks.pop_swap(m_pop);
+            m_pop.samples.swap(chunk);
+            if(!popped) return false;
+
+            stamp = m_pop.stamp;
+            m_items.try_wait();
+            return true;
+        }
+
+        /*!
+         * \brief Records that the radio dropped samples before the next chunk. Producer thread only.
+         */
+        void overflow()
+        {
+            m_overflows.fetch_add(1, std::memory_order_relaxed);
+            m_resync = true;
+        }
+
+        void wait_items() { m_items.wait(); } //!< Parks the consumer until a chunk was published since its last wait
+
+        /*!
+         * \brief Gets the statistics of the ring. May be called from any thread.
+         */
+        capture_stats stats()
+        {
+            capture_stats stats;
+            stats.chunks_captured = m_captured.load(std::memory_order_relaxed);
+            stats.chunks_dropped = m_dropped.load(std::memory_order_relaxed);
+            stats.radio_overflows = m_overflows.load(std::memory_order_relaxed);
+            stats.high_water = m_high_water.load(std::memory_order_relaxed);
+            stats.capacity = m_chunks.capacity();
+            stats.chunk_size = m_chunk_size;
+            return stats;
+        }
+
+        /*!
+         * \brief Starts the high-water mark over from zero. May be called from any thread.
+         */
+        void reset_high_water() { m_high_water.store(0, std::memory_order_relaxed); }
+
+    private:
+
+        /*!
+         * \brief A chunk of the ring
+         */
+        struct slot
+        {
+            std::vector<std::complex<double> > samples; //!< The samples
+            sample_stamp stamp;                         //!< Stamp of the first sample
+
+            slot(size_t size = 0) : samples(size) {}
+        };
+
+        spsc_queue<slot> m_chunks; //!< The chunks
+
+        slot m_chunk; //!< The chunk being filled by the producer
+
+        slot m_pop; //!< Consumer side storage swapped out of the ring
+
+        size_t m_chunk_size; //!< Number of samples per chunk
+
+        handoff m_items; //!< Posted for every chunk published
+
+        double m_rate; //!< Sample rate used to resynchronize the index (0 if unknown)
+
+        uint64_t m_next_index; //!< Index of the sample after the last chunk published (producer only)
+
+        uint64_t m_reference_index; //!< Index of the first sample published with a device time (producer only)
+
+        double m_reference_time; //!< Device time of that sample, negative until there is one (producer only)
+
+        bool m_resync; //!< Whether the radio overflowed since the last chunk with a device time (producer only)
+
+        std::atomic<uint64_t> m_captured; //!< Chunks published or dropped
+
+        std::atomic<uint64_t> m_dropped; //!< Chunks dropped
+
+        std::atomic<uint64_t> m_overflows; //!< Overflows reported by the radio
+
+        std::atomic<size_t> m_high_water; //!< Most chunks in the ring right after a publish
+    };
+}
+
+#endif // CAPTURE_RING_H
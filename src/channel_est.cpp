@@ -6,6 +6,7 @@
  *  of the channel attenuation & phase rotation to each of the subcarriers.
  */
 
+#include <algorithm>
 #include <cstring>
 
 #include "channel_est.h"
@@ -18,72 +19,59 @@ namespace wno
      *   + #m_chan_est -> 64 complex doubles each initialized to (1+0j)
      *   + #m_lts_flag -> 0 or in other words not in the LTS
      *   + #m_frame_start -> false
+     *   + #m_lts -> 64 complex doubles
+     *   + buffers -> max_input symbols in and out
      */
-    channel_est::channel_est() :
-        block("channel_est"),        
+    channel_est::channel_est(size_t max_input) :
+        block("channel_est", max_input, max_input),
         m_chan_est(64, std::complex<double>(1, 0)),
         m_lts_flag(0),
-        m_frame_start(false)
+        m_frame_start(false),
+        m_lts(64)
     {
     }
 
-    /*!
-     * This block constantly looks for the LTS_START flag to indicate the first LTS symbol.
-     * Once this symbol is found it then compares each sample in the two LTS symbols with the known
-     * transmitted sample and calculates the inverse channel effect. It then applies this
-     * channel correction to the rest of the symbol.
-     */
     void channel_est::work(){
 
-        if(input_buffer.size() == 0) return;
         output_buffer.resize(0);
+        if(input_buffer.size() == 0) return;
 
-        for(int i = 0; i < input_buffer.size(); i++)
-        {
-            // Start of LTS found
-            if(input_buffer[i].tag == LTS_START)
-            {
-                m_lts_flag = 1;
-                for(int j = 0; j < 64; j++) m_chan_est[j] = std::complex<double>(0.0,0.0);
-            }
+        vector_sink<tagged_vector<64> > sink(output_buffer);
+        for(int i = 0; i < input_buffer.size(); i++) process(input_buffer[i], sink);
+    }
 
-            if(m_lts_flag > 0) // This is a LTS symbol
-            {
-                // Calculate channel correction
-                for(int j = 0; j < 64; j++)
-                {
-                    std::complex<double> ref_lts_sample = LTS_FREQ_DOMAIN[j];
-                    std::complex<double> rec_lts_sample = input_buffer[i].samples[j];
-                    m_chan_est[j] += ref_lts_sample / rec_lts_sample / 2.0;
-                }
+    /*!
+     * Both LTS symbols carry the same signal, so on each used subcarrier half their sum is the
+     * signal plus half the noise and their difference is the noise of both.
+     *
+     * Both powers are floored at #SNR_POWER_FLOOR, since the noise estimate can exceed the
+     * sum at low SNR and both can be zero for identical or empty symbols.
+     */
+    void channel_est::estimate(const tagged_vector<64> & symbol)
+    {
+        double sum_power = 0;
+        double noise_power = 0;
 
-                m_lts_flag++;
-                if(m_lts_flag == 3) // No more LTS symbols
-                {
-                    m_lts_flag = 0;
-                    m_frame_start = true; // Next symbol is the start of frame
-                }
-            }
+        // Calculate channel correction
+        for(int j = 0; j < 64; j++)
+        {
+            std::complex<double> ref_lts_sample = LTS_FREQ_DOMAIN[j];
+            std::complex<double> rec_lts_sample = symbol.samples[j];
+            m_chan_est[j] += ref_lts_sample / rec_lts_sample / 2.0;
+
+            if(ref_lts_sample == 0.0) continue;
+            if(m_lts_flag == 1) m_lts[j] = rec_lts_sample;
             else
             {
-                tagged_vector<64> symbol;
-                if(m_frame_start)
-                {
-                    symbol.tag = START_OF_FRAME;
-                    m_frame_start = false;
-                }
-
-                // Apply channel correction
-                for(int j = 0; j < 64; j++)
-                {
-                    std::complex<double> out_sample = m_chan_est[j] * input_buffer[i].samples[j];
-                    symbol.samples[j] = out_sample;
-                }
-                output_buffer.push_back(symbol);
+                sum_power += std::norm(m_lts[j] + rec_lts_sample) / 4.0;
+                noise_power += std::norm(m_lts[j] - rec_lts_sample) / 2.0;
             }
         }
-    }
 
+        if(m_lts_flag == 2)
+        {
+            double signal_power = std::max(sum_power - noise_power / 2.0, SNR_POWER_FLOOR);
+            m_frame.snr = 10.0 * std::log10(signal_power / std::max(noise_power, SNR_POWER_FLOOR));
+        }
+    }
 }
-
-
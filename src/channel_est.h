@@ -15,6 +15,8 @@
 #include "tagged_vector.h"
 #include "block.h"
 
+#define SNR_POWER_FLOOR 1e-12 // Smallest signal and noise power the SNR estimate uses (bounds it to +-120 dB for unit power)
+
 namespace wno
 {
 
@@ -34,12 +36,31 @@ namespace wno
     public:
 
 
-        channel_est(); //!< Construct for Channel Estimate block.
+        /*!
+         * \brief Construct for Channel Estimate block.
+         * \param max_input Most symbols per call to work().
+         */
+        channel_est(size_t max_input = SYMBOL_BUFFER_MAX);
 
         virtual void work(); //!< Signal Processing happens here.
 
+        /*!
+         * \brief Processes one symbol.
+         * \param symbol The input symbol.
+         * \param sink Called with the equalized symbol unless the input is an LTS symbol.
+         */
+        template<typename Sink>
+        void process(const tagged_vector<64> & symbol, Sink & sink);
+
     private:
 
+        /*!
+         * \brief Adds an LTS symbol's contribution to the channel estimate. The second LTS
+         *  symbol is compared with the first one for the SNR of the frame.
+         * \param symbol The LTS symbol.
+         */
+        void estimate(const tagged_vector<64> & symbol);
+
 
         std::vector<std::complex<double> > m_chan_est; //!< Current channel estimate for each subcarrier.
 
@@ -58,7 +79,65 @@ namespace wno
          * or in other words the first symbol after the second LTS symbol.
          */
         bool m_frame_start;
+
+        /*!
+         * \brief Measurements of the current frame, taken from the first LTS symbol for the start
+         * of frame, with the SNR filled in.
+         */
+        frame_metrics m_frame;
+
+        /*!
+         * \brief The first LTS symbol of the current frame.
+         */
+        std::vector<std::complex<double> > m_lts;
     };
+
+    /*!
+     * This block constantly looks for the LTS_START flag to indicate the first LTS symbol.
+     * Once this symbol is found it then compares each sample in the two LTS symbols with the known
+     * transmitted sample and calculates the inverse channel effect. It then applies this
+     * channel correction to the rest of the symbol.
+     */
+    template<typename Sink>
+    inline void channel_est::process(const tagged_vector<64> & symbol, Sink & sink)
+    {
+        // Start of LTS found
+        if(symbol.tag == LTS_START)
+        {
+            m_lts_flag = 1;
+            m_frame = symbol.frame;
+            for(int j = 0; j < 64; j++) m_chan_est[j] = std::complex<double>(0.0,0.0);
+        }
+
+        if(m_lts_flag > 0) // This is a LTS symbol
+        {
+            estimate(symbol);
+
+            m_lts_flag++;
+            if(m_lts_flag == 3) // No more LTS symbols
+            {
+                m_lts_flag = 0;
+                m_frame_start = true; // Next symbol is the start of frame
+            }
+        }
+        else
+        {
+            tagged_vector<64> out;
+            if(m_frame_start)
+            {
+                out.tag = START_OF_FRAME;
+                out.frame = m_frame;
+                m_frame_start = false;
+            }
+
+            // Apply channel correction
+            for(int j = 0; j < 64; j++)
+            {
+                out.samples[j] = m_chan_est[j] * symbol.samples[j];
+            }
+            sink(out);
+        }
+    }
 }
 
 
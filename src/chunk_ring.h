@@ -0,0 +1,160 @@
+/*! \file chunk_ring.h
+ *  \brief Ring of item buffers connecting two pipelined blocks.
+ *
+ *  The chunk_ring class passes whole buffers (chunks) of items from a block running in
+ *  one thread to a block running in another thread without copying them.
+ */
+
+#ifndef CHUNK_RING_H
+#define CHUNK_RING_H
+
+#include <vector>
+
+#include "spsc_queue.h"
+#include "handoff.h"
+#include "tagged_vector.h"
+
+namespace wno
+{
+    /*!
+     * \brief The ring_base class.
+     *
+     * Lets a block_graph keep the rings between its blocks through generic pointers even
+     * though they hold different item types.
+     */
+    class ring_base
+    {
+    public:
+
+        virtual ~ring_base() {}
+    };
+
+    /*!
+     * \brief The chunk_ring class template.
+     *
+     * A bounded single producer single consumer ring of std::vector<T> chunks, each with
+     * the stream_tags of its items. Chunks are swapped in and out of the ring so the
+     * producer gets back the storage of a chunk the consumer is done with instead of
+     * allocating a new one.
+     *
+     * The ring itself is lock-free. The handoffs are only used to park a thread that
+     * found the ring empty (consumer) or full (producer), each push and pop posts the
+     * handoff of the other side and takes back its own side's post if it is still there,
+     * so the posts do not pile up while neither side is waiting.
+     */
+    template<typename T>
+    class chunk_ring : public ring_base
+    {
+    public:
+
+        /*!
+         * \brief Constructor for chunk_ring
+         * \param depth Minimum number of chunks the ring can hold.
+         * \param strategy How the producer and consumer wait when the ring is full or empty.
+         * \param spin_count Number of polls before blocking (WAIT_SPIN_THEN_BLOCK only).
+         */
+        chunk_ring(size_t depth, wait_strategy strategy = WAIT_BLOCK, int spin_count = DEFAULT_SPIN_COUNT) :
+            m_chunks(depth),
+            m_items(strategy, spin_count),
+            m_space(strategy, spin_count)
+        {
+        }
+
+        /*!
+         * \brief Adds a chunk to the ring. Producer thread only.
+         * \param chunk The chunk to add. On success it is replaced by an empty (recycled) chunk.
+         * \return False if the ring was full.
+         */
+        bool push(std::vector<T> & chunk)
+        {
+            m_untagged.clear();
+            return push(chunk, m_untagged);
+        }
+
+        /*!
+         * \brief Adds a chunk and its tags to the ring. Producer thread only.
+         * \param chunk The chunk to add. On success it is replaced by an empty (recycled) chunk.
+         * \param tags The tags of the chunk's items. On success they are replaced by an empty list.
+         * \return False if the ring was full.
+         */
+        bool push(std::vector<T> & chunk, std::vector<stream_tag> & tags)
+        {
+            m_push.items.swap(chunk);
+            m_push.tags.swap(tags);
+            bool pushed = m_chunks.push_swap(m_push);
+            m_push.items.swap(chunk);
+            m_push.tags.swap(tags);
+            if(!pushed) return false;
+
+            chunk.clear();
+            tags.clear();
+            m_space.try_wait();
+            m_items.post();
+            return true;
+        }
+
+        /*!
+         * \brief Removes the oldest chunk from the ring. Consumer thread only.
+         * \param chunk Set to the removed chunk. Its previous storage is kept for recycling.
+         * \return False if the ring was empty.
+         */
+        bool pop(std::vector<T> & chunk) { return pop(chunk, m_dropped_tags); }
+
+        /*!
+         * \brief Removes the oldest chunk and its tags from the ring. Consumer thread only.
+         * \param chunk Set to the removed chunk. Its previous storage is kept for recycling.
+         * \param tags Set to the tags of the removed chunk.
+         * \return False if the ring was empty.
+         */
+        bool pop(std::vector<T> & chunk, std::vector<stream_tag> & tags)
+        {
+            m_pop.items.swap(chunk);
+            m_pop.tags.swap(tags);
+            bool popped = m_chunks.pop_swap(m_pop);
+            m_pop.items.swap(chunk);
+            m_pop.tags.swap(tags);
+            if(!popped) return false;
+
+            m_items.try_wait();
+            m_space.post();
+            return true;
+        }
+
+        void wait_items() { m_items.wait(); } //!< Parks the consumer until a chunk was pushed since its last wait
+
+        void wait_space() { m_space.wait(); } //!< Parks the producer until a chunk was popped since its last wait
+
+        bool empty() const { return m_chunks.size() == 0; } //!< Whether the ring holds no chunk
+
+        bool full() const { return m_chunks.size() >= m_chunks.capacity(); } //!< Whether the ring has no room for another chunk
+
+        size_t depth() const { return m_chunks.capacity(); } //!< Get the number of chunks the ring can hold
+
+    private:
+
+        /*!
+         * \brief A chunk and its tags as stored in the ring
+         */
+        struct slot
+        {
+            std::vector<T> items;               //!< The items
+            std::vector<stream_tag> tags;       //!< The tags of the items
+        };
+
+        spsc_queue<slot> m_chunks; //!< The chunks
+
+        slot m_push; //!< Producer side storage swapped into the ring
+
+        slot m_pop; //!< Consumer side storage swapped out of the ring
+
+        std::vector<stream_tag> m_untagged; //!< The empty tags of chunks pushed without tags
+
+        std::vector<stream_tag> m_dropped_tags; //!< The tags of chunks popped without tags
+
+        handoff m_items; //!< Posted for every chunk pushed
+
+        handoff m_space; //!< Posted for every chunk popped
+    };
+}
+
+#endif // CHUNK_RING_H
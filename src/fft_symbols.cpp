@@ -17,67 +17,31 @@ namespace wno
      * - Initializations:
      *   + #m_offset -> 0
      *   + #m_ffft -> Instance of 64 point forward fft class
+     *   + buffers -> max_input samples in, #MAX_SYMBOLS of them out
      */
-    fft_symbols::fft_symbols() :
-        block("fft_symbols"),
+    fft_symbols::fft_symbols(size_t max_input) :
+        block("fft_symbols", max_input, MAX_SYMBOLS(max_input)),
         m_offset(0),
         m_ffft(64)
     {
     }
 
     /*!
-     * This block removes the cyclic prefix and vectorizes the samples into 64 sample symbols
-     * based on the tags marking the frame boundaries. It then performs a  64 point forward
-     * fft on each symbol to convert it from time domain to frequency domain.
+     * The samples are consumed in runs from one tag to the next.
      */
     void fft_symbols::work()
     {
-        if(input_buffer.size() == 0) return;
         output_buffer.resize(0);
+        if(input_buffer.size() == 0) return;
 
-        // Step through the input samples
-        for(int x = 0; x < input_buffer.size(); x++)
-        {
-            // Check if this is the start of a new frame
-            if(input_buffer[x].tag == LTS1)
-            {
-                // Push the current vector to the output buffer if
-                // we've written any data to it
-                if(m_offset > 15) output_buffer.push_back(m_current_vector);
-
-                // Start a new vector
-                m_current_vector.tag = LTS_START;
-                m_offset = 16;
-            }
-
-            if(input_buffer[x].tag == LTS2)
-            {
-                m_offset = 16;
-            }
-
-            // Copy over samples past the cyclic prefix
-            if(m_offset > 15)
-            {
-                m_current_vector.samples[m_offset - 16] = input_buffer[x].sample;
-            }
-
-            // Increment the offset and reset if we're at the end of the symbol
-            m_offset++;
-            if(m_offset == 80)
-            {
-                output_buffer.push_back(m_current_vector);
-                m_current_vector.tag = NONE;
-                m_offset = 0;
-            }
-        }
-
-        // Perform forward FFT
-        for(int x = 0; x < output_buffer.size(); x++)
+        vector_sink<tagged_vector<64> > sink(output_buffer);
+        size_t x = 0;
+        for(int t = 0; t < input_tags.size(); t++)
         {
-            m_ffft.forward(output_buffer[x].samples);
-
+            consume(input_buffer.data() + x, input_tags[t].offset - x, sink);
+            x = input_tags[t].offset;
+            align(input_tags[t].tag, input_tags[t].value, input_tags[t].stamp, sink);
         }
+        consume(input_buffer.data() + x, input_buffer.size() - x, sink);
     }
 }
-
-
@@ -11,6 +11,8 @@
 
 #include <vector>
 #include <complex>
+#include <algorithm>
+#include <cstring>
 #include <fftw3.h>
 
 #include "tagged_vector.h"
@@ -22,23 +24,71 @@ namespace wno
     /*!
      * \brief The fft_symbols block.
      *
-     * Inputs tagged_samples from timing_sync block (time domain samples).
+     * Inputs samples and their stream_tags from timing_sync block (time domain samples).
      * Outputs tagged_vectors to channel estimator block (frequency domain samples).
      *
      * This FFT Symbols aligns the input samples into symbols, chops off the cyclic prefixes,
      * and performs a forward FFT on vectorized samples to convert them from time domain
      * to frequency domain symbols.
      */
-    class fft_symbols : public wno::block<tagged_sample, tagged_vector<64> >
+    class fft_symbols : public wno::block<std::complex<double>, tagged_vector<64> >
     {
     public:
 
-        fft_symbols(); //!< Constructor for fft_symbols block.
+        /*!
+         * \brief Constructor for fft_symbols block.
+         * \param max_input Most samples per call to work().
+         */
+        fft_symbols(size_t max_input = BUFFER_MAX);
 
         virtual void work(); //!< Signal processing happens here.
 
+        /*!
+         * \brief Processes one sample.
+         * \param sample The input sample.
+         * \param sink Called with each completed frequency domain symbol.
+         */
+        template<typename Sink>
+        void process(const tagged_sample & sample, Sink & sink)
+        {
+            if(sample.tag != NONE) align(sample.tag, sample.value, sample.stamp, sink);
+            consume(&sample.sample, 1, sink);
+        }
+
     private:
 
+        /*!
+         * \brief Realigns the symbols on an #LTS1 or #LTS2 tag and collects the frame_metrics
+         *  the tags carry.
+         * \param tag The tag of the next sample.
+         * \param value The tag's value.
+         * \param stamp The tag's stamp.
+         * \param sink Called with the symbol cut short by the tag, if any.
+         */
+        template<typename Sink>
+        void align(vector_tag tag, double value, const sample_stamp & stamp, Sink & sink);
+
+        /*!
+         * \brief Copies untagged samples into the symbols, skipping the cyclic prefixes.
+         * \param samples The samples.
+         * \param count Number of samples.
+         * \param sink Called with each completed frequency domain symbol.
+         */
+        template<typename Sink>
+        void consume(const std::complex<double> * samples, size_t count, Sink & sink);
+
+        /*!
+         * \brief Transforms the current vector and passes it to the sink.
+         * \param sink The sink.
+         */
+        template<typename Sink>
+        void emit(Sink & sink)
+        {
+            tagged_vector<64> symbol = m_current_vector;
+            m_ffft.forward(symbol.samples);
+            sink(symbol);
+        }
+
         /*!
          * \brief Current vector being filled
          */
@@ -53,7 +103,84 @@ namespace wno
          * \brief Forward FFT
          */
         fft m_ffft;
+
+        /*!
+         * \brief Measurements of the last frame detected, passed on with the #LTS_START symbol
+         */
+        frame_metrics m_frame;
     };
+
+    /*!
+     * This block removes the cyclic prefix and vectorizes the samples into 64 sample symbols
+     * based on the tags marking the frame boundaries. It then performs a  64 point forward
+     * fft on each symbol to convert it from time domain to frequency domain.
+     *
+     * The first LTS symbol of a frame carries the stamp and RSSI of the frame's #STS_START
+     * and the frequency offset of its #LTS1.
+     */
+    template<typename Sink>
+    inline void fft_symbols::align(vector_tag tag, double value, const sample_stamp & stamp, Sink & sink)
+    {
+        if(tag == STS_START)
+        {
+            m_frame.stamp = stamp;
+            m_frame.rssi = value;
+        }
+
+        // Check if this is the start of a new frame
+        if(tag == LTS1)
+        {
+            // Emit the current vector if we've written any data to it
+            if(m_offset > 15) emit(sink);
+
+            // Start a new vector
+            m_current_vector.tag = LTS_START;
+            m_frame.cfo = value;
+            m_current_vector.frame = m_frame;
+            m_offset = 16;
+        }
+
+        if(tag == LTS2)
+        {
+            m_offset = 16;
+        }
+    }
+
+    /*!
+     * Whole runs of samples up to the end of the cyclic prefix or of the symbol are
+     * skipped or copied at once.
+     */
+    template<typename Sink>
+    inline void fft_symbols::consume(const std::complex<double> * samples, size_t count, Sink & sink)
+    {
+        while(count)
+        {
+            // Skip the cyclic prefix
+            if(m_offset < 16)
+            {
+                size_t skip = std::min((size_t)(16 - m_offset), count);
+                m_offset += skip;
+                samples += skip;
+                count -= skip;
+                continue;
+            }
+
+            // Copy over samples past the cyclic prefix
+            size_t copy = std::min((size_t)(80 - m_offset), count);
+            memcpy(&m_current_vector.samples[m_offset - 16], samples, copy * sizeof(std::complex<double>));
+            m_offset += copy;
+            samples += copy;
+            count -= copy;
+
+            // Reset if we're at the end of the symbol
+            if(m_offset == 80)
+            {
+                emit(sink);
+                m_current_vector.tag = NONE;
+                m_offset = 0;
+            }
+        }
+    }
 }
 
 
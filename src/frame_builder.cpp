@@ -42,7 +42,8 @@ namespace wno
     *  + #m_ifft -> 64 point IFFT object
     */
     frame_builder::frame_builder() :
-        m_ifft(64)
+        m_ifft(64),
+        m_underlay()
     {
     }
 
@@ -98,7 +99,8 @@ namespace wno
         memcpy(&frame[320], &prefixed[0], prefixed.size() * sizeof(std::complex<double>));
 
         // Make the payload size to a multiple of PN-sequence size. (for convenience)
-        int pad_length = pnSize - frame.size()%pnSize;
+        int pn_length = m_underlay.pn_length();
+        int pad_length = pn_length - frame.size()%pn_length;
         std::cout << "padding zeros : " << pad_length << std::endl;
         std::vector<std::complex<double> > paddedframe(frame.size() + pad_length);
         memcpy(&paddedframe[0], &frame[0], frame.size() * sizeof(std::complex<double>));
@@ -115,11 +117,10 @@ namespace wno
 
         outfile.close();
         //XXX:Adding underlay after preamble. still in testing phase
-        underlay ul = underlay();
-        std::vector<std::complex<double> > combined = ul.add_underlay(paddedframe);
-        
+        m_underlay.add_underlay(paddedframe);
+
         // Return the samples
-        return combined;
+        return paddedframe;
         // ---------------------------------------------
     }
 }
@@ -21,6 +21,7 @@
 
 #include "fft.h"
 #include "rates.h"
+#include "underlay.h"
 
 namespace wno
 {
@@ -65,6 +66,8 @@ namespace wno
 
         fft m_ifft; //!< The fft instance used to perform the inverse FFT on the OFDM symbols
 
+        underlay m_underlay; //!< The underlay added to the frames, its phase continues from frame to frame
+
     };
 }
 
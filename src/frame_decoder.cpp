@@ -7,6 +7,7 @@
 
 #include <iostream>
 #include <cstring>
+#include <cmath>
 #include <arpa/inet.h>
 #include <boost/crc.hpp>
 
@@ -26,12 +27,27 @@ namespace wno
     /*!
      * - Initializations:
      *   + #m_current_frame -> Reset to a frame of 0 length with RATE_1_2_BPSK
+     *   + #m_pool -> num_workers decoder threads (NULL for none)
+     *   + #m_payloads -> #DEFAULT_PAYLOAD_POOL_SIZE buffers of MAX_FRAME_SIZE bytes
+     *   + buffers -> max_input symbols in, a payload per two of them out (the SIGNAL symbol and at
+     *     least one data symbol per frame)
      */
-    frame_decoder::frame_decoder() :
-        block("frame_decoder"),
-        m_current_frame(FrameData(RateParams(RATE_1_2_BPSK)))
+    frame_decoder::frame_decoder(int num_workers, size_t max_input) :
+        block("frame_decoder", max_input, max_input / 2 + 1),
+        m_current_frame(FrameData(RateParams(RATE_1_2_BPSK))),
+        m_pool(num_workers > 0 ? new work_stealing_pool(num_workers) : NULL),
+        m_payloads(DEFAULT_PAYLOAD_POOL_SIZE, MAX_FRAME_SIZE)
     {
         m_current_frame.Reset(RateParams(RATE_1_2_BPSK), 0, 0);
+        sem_init(&m_decoded, 0, 0);
+    }
+
+    void frame_decoder::work()
+    {
+        output_buffer.resize(0);
+
+        vector_sink<rx_packet> sink(output_buffer);
+        for(int x = 0; x < input_buffer.size(); x++) process(input_buffer[x], sink);
     }
 
     /*!
@@ -41,54 +57,108 @@ namespace wno
      * header.  If that is successful as deteremined by an IEEE CRC-32 check, the decoded payload
      * is passed to the output_buffer to be returned to the receive chain so that it can be passed
      * up to the MAC layer.
+     *
+     * The payload decoding itself is handed off by #start_decode(), the payloads decoded
+     * so far are delivered by #process() after each symbol.
      */
-    void frame_decoder::work()
+    void frame_decoder::consume(const tagged_vector<48> & symbol)
     {
-        if(input_buffer.size() == 0) return;
-        output_buffer.resize(0);
+        // Copy over available symbols
+        if(m_current_frame.samples_copied < m_current_frame.sample_count)
+        {
+            memcpy(&m_current_frame.samples[m_current_frame.samples_copied], &symbol.samples[0], 48 * sizeof(std::complex<double>));
+            m_current_frame.samples_copied += 48;
+            m_current_frame.pilot_error += symbol.pilot_error;
+            m_current_frame.symbols++;
+        }
 
-        // Step through each 48 sample symbol
-        for(int x = 0; x < input_buffer.size(); x++)
+        // Decode the frame if possible
+        if(m_current_frame.samples_copied >= m_current_frame.sample_count && m_current_frame.sample_count != 0)
         {
-            // Copy over available symbols
-            if(m_current_frame.samples_copied < m_current_frame.sample_count)
-            {
-                memcpy(&m_current_frame.samples[m_current_frame.samples_copied], &input_buffer[x].samples[0], 48 * sizeof(std::complex<double>));
-                m_current_frame.samples_copied += 48;
-            }
-
-            // Decode the frame if possible
-            if(m_current_frame.samples_copied >= m_current_frame.sample_count && m_current_frame.sample_count != 0)
-            {
-                ppdu frame = ppdu(m_current_frame.rate_params.rate, m_current_frame.length);
-                if(frame.decode_data(m_current_frame.samples))
-                {
-                    output_buffer.push_back(frame.get_payload());
-                }
-                m_current_frame.sample_count = 0;
-            }
-
-            // Look for a start of frame
-            if(input_buffer[x].tag == START_OF_FRAME)
-            {
-                // Attempt to decode the header
-                ppdu h = ppdu();
-                std::vector<std::complex<double> > header_samples(48);
-                memcpy(header_samples.data(), input_buffer[x].samples, 48 * sizeof(std::complex<double>));
-                if(!h.decode_header(header_samples)) continue;
-
-                // Calculate the frame sample count
-                int length = h.get_length();
-                RateParams rate_params = RateParams(h.get_rate());
-                int frame_sample_count = h.get_num_symbols() * 48;
-
-                // Start a new frame
-                m_current_frame.Reset(rate_params, frame_sample_count, length);
-                m_current_frame.samples.resize(h.get_num_symbols() * 48);
-                continue;
-            }
+            start_decode();
+            m_current_frame.sample_count = 0;
+        }
+
+        // Look for a start of frame
+        if(symbol.tag == START_OF_FRAME)
+        {
+            // Attempt to decode the header
+            ppdu h = ppdu();
+            std::vector<std::complex<double> > header_samples(48);
+            memcpy(header_samples.data(), symbol.samples, 48 * sizeof(std::complex<double>));
+            if(!h.decode_header(header_samples)) return;
+
+            // Calculate the frame sample count
+            int length = h.get_length();
+            RateParams rate_params = RateParams(h.get_rate());
+            int frame_sample_count = h.get_num_symbols() * 48;
+
+            // Start a new frame
+            m_current_frame.Reset(rate_params, frame_sample_count, length);
+            m_current_frame.samples.resize(h.get_num_symbols() * 48);
+            m_current_frame.frame = symbol.frame;
+            m_current_frame.pilot_error = symbol.pilot_error;
+            m_current_frame.symbols = 1;
         }
     }
-}
 
+    /*!
+     * The samples are swapped into a recycled job so that neither the samples nor the
+     * storage of the next frame are allocated or copied.
+     */
+    void frame_decoder::start_decode()
+    {
+        decode_job * job;
+        if(m_free_jobs.empty()) job = new decode_job();
+        else
+        {
+            job = m_free_jobs.back();
+            m_free_jobs.pop_back();
+        }
+        job->rate = m_current_frame.rate_params.rate;
+        job->length = m_current_frame.length;
+        job->samples.swap(m_current_frame.samples);
+
+        rx_packet & packet = job->packet;
+        packet.stamp = m_current_frame.frame.stamp;
+        packet.rssi = m_current_frame.frame.rssi;
+        packet.cfo = m_current_frame.frame.cfo;
+        packet.snr = m_current_frame.frame.snr;
+        packet.evm = std::sqrt(m_current_frame.pilot_error / (4 * m_current_frame.symbols));
+        packet.rate = job->rate;
+        packet.length = job->length;
+
+        job->done = false;
+        m_pending.push_back(job);
+
+        if(!m_pool || m_pending.size() > MAX_PENDING_FRAMES) decode(job);
+        else m_pool->submit(std::bind(&frame_decoder::decode, this, job));
+    }
+
+    /*!
+     * The payload is decoded straight into a buffer of #m_payloads, which goes back to the
+     * pool right away if the CRC fails.
+     */
+    void frame_decoder::decode(decode_job * job)
+    {
+        ppdu frame = ppdu(job->rate, job->length);
+        job->packet.payload = m_payloads.acquire();
+        job->valid = frame.decode_data(job->samples, job->packet.payload.bytes());
+        if(job->valid) job->packet.path_metric = frame.get_path_metric();
+        else job->packet.payload.release();
+        job->done = true;
+        sem_post(&m_decoded);
+    }
 
+    void frame_decoder::finish()
+    {
+        output_buffer.resize(0);
+        drain(output_buffer);
+    }
+
+    void frame_decoder::drain(std::vector<rx_packet> & packets)
+    {
+        vector_sink<rx_packet> sink(packets);
+        deliver(sink, true);
+    }
+}
@@ -12,12 +12,20 @@
 #ifndef FRAME_DECODER_H
 #define FRAME_DECODER_H
 
+#include <atomic>
 #include <complex>
 #include <deque>
+#include <semaphore.h>
 
 #include "tagged_vector.h"
+#include "rx_packet.h"
+#include "payload_pool.h"
 #include "rates.h"
 #include "block.h"
+#include "work_stealing_pool.h"
+
+#define DEFAULT_DECODE_WORKERS 2 // Frame decoding threads of a frame_decoder
+#define MAX_PENDING_FRAMES 16    // Frames being decoded at once before the block decodes frames itself
 
 namespace wno
 {
@@ -31,18 +39,22 @@ namespace wno
       int sample_count;                          //!< Number of samples in this frame
       int samples_copied;                        //!< Number of samples already copied
       RateParams rate_params;                    //!< Rate parameters for this frame
-      std::vector<std::complex<double> > samples; //!< Decoded Samples
+      std::vector<std::complex<double> > samples; //!< Decoded Samples (resized to the frame when its header is decoded)
       int length;                                //!< Data length
       int required_samples;                      //!< Number of samples required to decode frame
+      frame_metrics frame;                       //!< Measurements of the frame's preamble
+      double pilot_error;                        //!< Sum of the pilot errors of the frame's symbols so far
+      int symbols;                               //!< Number of symbols in #pilot_error
 
       /*!
        * \brief Constructor for FrameData
        * \param _rate_params the rate parameters for this frame
        */
       FrameData(RateParams _rate_params) :
-        rate_params(_rate_params)
+        rate_params(_rate_params),
+        pilot_error(0),
+        symbols(0)
       {
-        samples.reserve(100000);
       }
 
       /*!
@@ -64,33 +76,158 @@ namespace wno
       }
     };
 
+    /*!
+     * \brief A complete frame handed to a decoder worker
+     */
+    struct decode_job
+    {
+        Rate rate;                                  //!< Rate of the frame
+        int length;                                 //!< Data length
+        std::vector<std::complex<double> > samples; //!< The frame's data subcarrier samples
+        rx_packet packet;                           //!< The decoded payload and the frame's stamp and metrics
+        bool valid;                                 //!< Whether the payload passed the CRC
+        std::atomic<bool> done;                     //!< Set once #packet and #valid are final
+    };
+
     /*!
      * \brief The frame_decoder block.
      *
      * Inputs tagged_vector<48> from phase_tracker block.
-     * Outputs std::vector<unsigned char> back to the receiver chain
+     * Outputs rx_packet back to the receiver chain
      *
      * The Frame Decoder block is in charge of decoding the frame header and then the frame body.
      * This includes demodulating, deinterleaving, de-convolutional-coding, and descrambling.
      * First these must all be done to the header so as to get the correct rate and length of
      * the payload, then the payload must be decoded as well. If the block is succesful in
      * decoding the frame as determined by an IEEE CRC-32 check the payload is passed into
-     * the output_buffer as unsigned char's or bytes.
+     * the output_buffer as unsigned char's or bytes, along with the stamp and metrics the start
+     * of frame symbol carries, the EVM of the pilots of the frame's symbols and the Viterbi path
+     * metric of its data. The payloads are decoded straight into buffers of the block's
+     * payload_pool and handed up in the packets without being copied.
+     *
+     * The block thread only decodes the headers and collects the symbols of each frame.
+     * Complete frames are decoded by a work_stealing_pool so that a long frame at a low rate
+     * does not stall the chain, and the payloads are put in the output_buffer in the order
+     * the frames were received, by the first call to #work() after they are decoded.
+     * If #MAX_PENDING_FRAMES frames are still being decoded the block decodes the next frame
+     * itself, which slows it down to the rate the frames can be decoded at.
      */
-    class frame_decoder : public wno::block<tagged_vector<48>, std::vector<unsigned char> >
+    class frame_decoder : public wno::block<tagged_vector<48>, rx_packet>
     {
     public:
 
-        frame_decoder(); //!< Constructor for frame_decoder block.
+        /*!
+         * \brief Constructor for frame_decoder block.
+         * \param num_workers Number of frame decoding threads, 0 to decode the frames in
+         *  the block's own thread (unless a pool is set with #set_pool()).
+         * \param max_input Most symbols per call to work().
+         */
+        frame_decoder(int num_workers = DEFAULT_DECODE_WORKERS, size_t max_input = SYMBOL_BUFFER_MAX);
 
         virtual void work(); //!< Signal processing happens here.
 
+        virtual void finish(); //!< Waits for the frames still being decoded and outputs their payloads
+
+        /*!
+         * \brief Processes one symbol.
+         * \param symbol The input symbol.
+         * \param sink Called with the packet of every frame decoded since the last call
+         *  that passed the CRC, oldest first. The packet is passed as an rvalue.
+         */
+        template<typename Sink>
+        void process(const tagged_vector<48> & symbol, Sink & sink);
+
+        /*!
+         * \brief Decodes the frames on a shared pool instead of the block's own workers.
+         * \param pool The pool to decode the frames on.
+         */
+        void set_pool(work_stealing_pool * pool) { m_pool = pool; }
+
+        /*!
+         * \brief Waits for the frames still being decoded. Must not run concurrently with #work().
+         * \param packets The packets of the frames that passed the CRC are appended to this.
+         */
+        void drain(std::vector<rx_packet> & packets);
+
+        /*!
+         * \brief Same as #drain() with the packets passed to a sink.
+         * \param sink Called with each packet as in #process().
+         */
+        template<typename Sink>
+        void drain(Sink & sink) { deliver(sink, true); }
+
     private:
 
+        /*!
+         * \brief Collects a symbol into the current frame, decoding the header of a new frame.
+         * \param symbol The input symbol.
+         */
+        void consume(const tagged_vector<48> & symbol);
+
+        /*!
+         * \brief Hands the current frame to the decoder workers (or decodes it right away).
+         */
+        void start_decode();
+
+        /*!
+         * \brief Decodes a frame. Runs on a decoder worker.
+         * \param job The frame to decode.
+         */
+        void decode(decode_job * job);
+
+        /*!
+         * \brief Passes the packets of the oldest decoded frames to a sink.
+         * \param sink Called with each packet that passed the CRC.
+         * \param wait Wait for all pending frames instead of stopping at the first one that is not done.
+         */
+        template<typename Sink>
+        void deliver(Sink & sink, bool wait);
+
         FrameData m_current_frame; //!< Current frame that is being decoded.
 
+        work_stealing_pool * m_pool; //!< Decoder workers (NULL to decode in the block thread)
+
+        std::deque<decode_job *> m_pending; //!< Frames handed to the workers, oldest first
+
+        std::vector<decode_job *> m_free_jobs; //!< Delivered jobs kept for their sample storage
+
+        sem_t m_decoded; //!< Posted by the workers for every frame decoded
+
+        payload_pool m_payloads; //!< Buffers the payloads are decoded into, handed out with the packets
+
     };
 
+    template<typename Sink>
+    inline void frame_decoder::process(const tagged_vector<48> & symbol, Sink & sink)
+    {
+        consume(symbol);
+        if(!m_pending.empty()) deliver(sink, false);
+    }
+
+    /*!
+     * Every decoded frame posts #m_decoded once. Delivering a frame takes back its post if
+     * it is still there so that the posts do not pile up while nobody waits.
+     */
+    template<typename Sink>
+    void frame_decoder::deliver(Sink & sink, bool wait)
+    {
+        while(!m_pending.empty())
+        {
+            decode_job * job = m_pending.front();
+            if(!job->done)
+            {
+                if(!wait) break;
+                sem_wait(&m_decoded);
+                continue;
+            }
+            sem_trywait(&m_decoded);
+
+            if(job->valid) sink(std::move(job->packet));
+            m_pending.pop_front();
+            m_free_jobs.push_back(job);
+        }
+    }
+
 }
 #endif // FRAME_DECODER_H
 
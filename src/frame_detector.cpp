@@ -16,81 +16,57 @@ namespace wno
      * - Initializations:
      *   + #m_power_acc      -> #STS_LENGTH (16 samples)
      *   + #m_corr_acc       -> #STS_LENGTH (16 samples)
-     *   + #m_carryover      -> #STS_LENGTH (16 samples)
+     *   + #m_delay          -> #STS_LENGTH (16 samples)
      *   + #m_plateau_length -> 0
      *   + #m_plateau_flag   -> false
+     *   + #m_received       -> 0, with no device time until a #CHUNK_START arrives
+     *   + buffers -> max_input samples in, as many tagged samples out
      */
-    frame_detector::frame_detector() :
-        block("frame_detector"),
+    frame_detector::frame_detector(size_t max_input) :
+        block("frame_detector", max_input, max_input),
         m_power_acc(STS_LENGTH),
         m_corr_acc(STS_LENGTH),
-        m_carryover(STS_LENGTH, 0),
+        m_delay(STS_LENGTH, 0),
+        m_delay_index(0),
         m_plateau_length(0),
-        m_plateau_flag(false)
+        m_plateau_flag(false),
+        m_received(0),
+        m_rate(0)
     {
     }
 
     /*!
-     * This block uses auto-correlation to detect the short training sequence.
-     * This autocorrelation is achieved through a moving window average
-     * using the circular accumulators to keep track of the current
-     * auto-correlation and input power of the input samples. The normalized
-     * auto-correlation is then compared to a threshold to determine if
-     * the current samples are part of the STS or not.
+     * The samples are passed through untouched, only the few tagged ones are listed in
+     * the output_tags. The #CHUNK_START tags of the input are consumed here. Without input
+     * the output is cleared, since in the lock-step schedule it holds the buffer swapped in
+     * from the next block.
      */
     void frame_detector::work()
     {
-        if(input_buffer.size() == 0) return;
-        output_buffer.resize(input_buffer.size());
+        output_tags.resize(0);
+        if(input_buffer.size() == 0)
+        {
+            output_buffer.resize(0);
+            return;
+        }
+        output_buffer.assign(input_buffer.begin(), input_buffer.end());
 
-        // Step through the samples
+        double value = 0;
+        int t = 0;
         for(int x = 0; x < input_buffer.size(); x++)
         {
-            output_buffer[x].tag = NONE;
-
-            // Get the delayed samples
-            std::complex<double> delayed;
-            if(x < STS_LENGTH) delayed = m_carryover[x];
-            else delayed = input_buffer[x-STS_LENGTH];
-
-            // Update the correlation accumulators
-            m_corr_acc.add(input_buffer[x] * std::conj(delayed));
-
-            // Update the power accumulator
-            m_power_acc.add(std::norm(input_buffer[x]));
-
-            // Calculate the normalized correlations
-            double corr = std::abs(m_corr_acc.sum) / m_power_acc.sum;
-
-            if(corr > PLATEAU_THRESHOLD)
-            {
-                m_plateau_length++;
-                if(m_plateau_length == STS_PLATEAU_LENGTH)
-                {
-                    output_buffer[x].tag = STS_START;
-                    m_plateau_flag = true;
-                }
-            }
-            else
+            for(; t < input_tags.size() && input_tags[t].offset == x; t++)
             {
-                if(m_plateau_flag)
-                {
-                    output_buffer[x].tag = STS_END;
-                    m_plateau_flag = false;
-                }
-                m_plateau_length = 0;
+                if(input_tags[t].tag != CHUNK_START) continue;
+                m_reference = input_tags[t].stamp;
+                m_received = m_reference.index;
+                m_rate = input_tags[t].value;
             }
 
-            // Pass through the sample
-            output_buffer[x].sample = input_buffer[x];
+            vector_tag tag = detect(input_buffer[x], value);
+            if(tag != NONE) output_tags.push_back(stream_tag(x, tag, value, stamp()));
+            m_received++;
         }
-
-        // Carryover the last 16 output samples
-        memcpy(&m_carryover[0],
-               &input_buffer[input_buffer.size() - STS_LENGTH],
-               STS_LENGTH * sizeof(std::complex<double>));
     }
 
 }
-
-
@@ -15,6 +15,7 @@
 #define STS_LENGTH 16
 
 #include <complex>
+#include <stdint.h>
 
 #include "block.h"
 #include "tagged_vector.h"
@@ -26,21 +27,59 @@ namespace wno
      * \brief The frame_detector block.
      *
      * Inputs complex doubles from USRP block.
-     * Outputs tagged samples to timing sync block.
+     * Outputs the same samples and stream_tags marking the STS to timing sync block.
      *
      * This block is in charge of detecting the beginning of a frame using the
      * short training sequence in the preamble.
+     *
+     * The tags it sets are stamped with the absolute index and device time of their sample.
+     * The block counts its input samples from 0, and a #CHUNK_START tag in its input
+     * restarts the count at the chunk's stamp so that dropped chunks are accounted for.
      */
-    class frame_detector : public wno::block<std::complex<double>, tagged_sample>
+    class frame_detector : public wno::block<std::complex<double>, std::complex<double> >
     {
     public:
 
-        frame_detector(); //!< Constructor for frame_detector block.
+        /*!
+         * \brief Constructor for frame_detector block.
+         * \param max_input Most samples per call to work().
+         */
+        frame_detector(size_t max_input = BUFFER_MAX);
 
         virtual void work(); //!< Signal processing happens here.
 
+        /*!
+         * \brief Processes one sample.
+         * \param sample The input sample.
+         * \param sink Called with the tagged output sample.
+         */
+        template<typename Sink>
+        void process(const std::complex<double> & sample, Sink & sink)
+        {
+            double value = 0;
+            vector_tag tag = detect(sample, value);
+            if(tag == NONE) sink(tagged_sample(sample));
+            else sink(tagged_sample(sample, tag, value, stamp()));
+            m_received++;
+        }
+
     private:
 
+        /*!
+         * \brief Gets the stamp of the current input sample.
+         */
+        sample_stamp stamp() { return m_reference.after(m_received - m_reference.index, m_rate); }
+
+        /*!
+         * \brief Runs the detection on one sample.
+         * \param sample The input sample.
+         * \param value Set to the tag's value: the mean power of the last #STS_LENGTH samples in
+         *  dB (the RSSI of the frame) for #STS_START and the length of the plateau in samples
+         *  for #STS_END.
+         * \return The sample's tag.
+         */
+        vector_tag detect(const std::complex<double> & sample, double & value);
+
         /*!
          * \brief Circular accumulator for calculating correlation.
          */
@@ -63,11 +102,80 @@ namespace wno
         bool m_plateau_flag;
 
         /*!
-         * \brief Vector for storing the last 16 samples from the input_buffer
-         * and carrying them over to the next call to #work()
+         * \brief The last 16 input samples, used as a circular buffer
+         */
+        std::vector<std::complex<double> > m_delay;
+
+        /*!
+         * \brief Index of the oldest sample in #m_delay
+         */
+        int m_delay_index;
+
+        /*!
+         * \brief Absolute index of the current input sample
+         */
+        uint64_t m_received;
+
+        /*!
+         * \brief Stamp of the last #CHUNK_START, the times of the later samples are counted from it
          */
-        std::vector<std::complex<double> > m_carryover;
+        sample_stamp m_reference;
+
+        /*!
+         * \brief Sample rate of the last #CHUNK_START (0 if unknown)
+         */
+        double m_rate;
     };
+
+    /*!
+     * This block uses auto-correlation to detect the short training sequence.
+     * This autocorrelation is achieved through a moving window average
+     * using the circular accumulators to keep track of the current
+     * auto-correlation and input power of the input samples. The normalized
+     * auto-correlation is then compared to a threshold to determine if
+     * the current samples are part of the STS or not.
+     */
+    inline vector_tag frame_detector::detect(const std::complex<double> & sample, double & value)
+    {
+        vector_tag tag = NONE;
+
+        // Get the delayed sample
+        std::complex<double> delayed = m_delay[m_delay_index];
+        m_delay[m_delay_index] = sample;
+        if(++m_delay_index == STS_LENGTH) m_delay_index = 0;
+
+        // Update the correlation accumulators
+        m_corr_acc.add(sample * std::conj(delayed));
+
+        // Update the power accumulator
+        m_power_acc.add(std::norm(sample));
+
+        // Calculate the normalized correlations
+        double corr = std::abs(m_corr_acc.sum) / m_power_acc.sum;
+
+        if(corr > PLATEAU_THRESHOLD)
+        {
+            m_plateau_length++;
+            if(m_plateau_length == STS_PLATEAU_LENGTH)
+            {
+                tag = STS_START;
+                value = 10.0 * std::log10(m_power_acc.sum / STS_LENGTH);
+                m_plateau_flag = true;
+            }
+        }
+        else
+        {
+            if(m_plateau_flag)
+            {
+                tag = STS_END;
+                value = m_plateau_length;
+                m_plateau_flag = false;
+            }
+            m_plateau_length = 0;
+        }
+
+        return tag;
+    }
 }
 
 
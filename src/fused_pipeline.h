@@ -0,0 +1,89 @@
+/*! \file fused_pipeline.h
+ *  \brief Header file for the fused_pipeline class template.
+ *
+ *  The fused_pipeline class template chains the process() functions of a series of blocks
+ *  at compile time, so that every item a block produces is handed straight to the next
+ *  block without going through the blocks' output and input buffers.
+ */
+
+#ifndef FUSED_PIPELINE_H
+#define FUSED_PIPELINE_H
+
+namespace wno
+{
+    /*!
+     * \brief The fused_pipeline class template.
+     *
+     * A fused_pipeline<Sink, B1, B2, ..., Bn> passes each item given to it to
+     * B1::process(item, sink) where the sink is the fused_pipeline<Sink, B2, ..., Bn> of
+     * the remaining blocks, and so on until Bn passes its items to the final Sink. Since
+     * every process() function is a member template defined in its block's header, the
+     * compiler can inline the whole chain into one loop over the input items, keeping
+     * the items in registers instead of writing every intermediate buffer to memory.
+     *
+     * The pipeline only holds references to the blocks and the final sink.
+     */
+    template<typename Sink, typename Block, typename... Rest>
+    class fused_pipeline
+    {
+    public:
+
+        /*!
+         * \brief Constructor for fused_pipeline
+         * \param sink The sink the last block passes its items to.
+         * \param block The first block.
+         * \param rest The remaining blocks in order.
+         */
+        fused_pipeline(Sink & sink, Block & block, Rest & ... rest) :
+            m_block(block),
+            m_next(sink, rest...)
+        {
+        }
+
+        /*!
+         * \brief Runs an item through the blocks.
+         * \param item The input item of the first block.
+         */
+        template<typename Item>
+        void operator()(const Item & item) { m_block.process(item, m_next); }
+
+    private:
+
+        Block & m_block; //!< The first block
+        fused_pipeline<Sink, Rest...> m_next; //!< The remaining blocks
+    };
+
+    /*!
+     * \brief The last block of a fused_pipeline, passing its items to the final sink.
+     */
+    template<typename Sink, typename Block>
+    class fused_pipeline<Sink, Block>
+    {
+    public:
+
+        /*!
+         * \brief Constructor for fused_pipeline
+         * \param sink The sink the block passes its items to.
+         * \param block The block.
+         */
+        fused_pipeline(Sink & sink, Block & block) :
+            m_block(block),
+            m_sink(sink)
+        {
+        }
+
+        /*!
+         * \brief Runs an item through the block.
+         * \param item The input item of the block.
+         */
+        template<typename Item>
+        void operator()(const Item & item) { m_block.process(item, m_sink); }
+
+    private:
+
+        Block & m_block; //!< The block
+        Sink & m_sink; //!< The final sink
+    };
+}
+
+#endif // FUSED_PIPELINE_H
@@ -0,0 +1,57 @@
+/*! \file fused_receiver.cpp
+ *  \brief C++ file for the fused_receiver class.
+ *
+ *  The fused_receiver class runs the overlay blocks of the receiver chain as one
+ *  fused_pipeline on the caller's thread.
+ */
+
+#include "fused_receiver.h"
+
+namespace wno
+{
+    /*!
+     * - Initializations:
+     *   + blocks -> sized for one input item at a time, their buffers go unused
+     *   + #m_frame_decoder -> No decoder workers, the frames are decoded inline
+     *   + #m_pipeline -> The blocks in chain order ending in #m_sink
+     *   + #m_tail -> The blocks after the timing_sync ending in #m_sink
+     */
+    fused_receiver::fused_receiver() :
+        m_frame_detector(1),
+        m_timing_sync(1),
+        m_fft_symbols(1),
+        m_channel_est(1),
+        m_phase_tracker(1),
+        m_frame_decoder(0, 1),
+        m_sink(m_packets),
+        m_pipeline(m_sink, m_frame_detector, m_timing_sync, m_fft_symbols, m_channel_est, m_phase_tracker, m_frame_decoder),
+        m_tail(m_sink, m_fft_symbols, m_channel_est, m_phase_tracker, m_frame_decoder)
+    {
+    }
+
+    std::vector<rx_packet> fused_receiver::process_samples(const std::vector<std::complex<double> > & samples)
+    {
+        m_packets.resize(0);
+        for(int x = 0; x < samples.size(); x++) m_pipeline(samples[x]);
+
+        std::vector<rx_packet> packets;
+        packets.swap(m_packets);
+        return packets;
+    }
+
+    /*!
+     * The timing_sync outputs each sample #LOOKBACK_LENGTH + #LOOKAHEAD_LENGTH samples after
+     * it came in, so that many zeros push out the ones it holds. The zeros go in behind the
+     * frame_detector so that they are not counted as received samples.
+     */
+    std::vector<rx_packet> fused_receiver::flush()
+    {
+        m_packets.resize(0);
+        for(int x = 0; x < LOOKBACK_LENGTH + LOOKAHEAD_LENGTH; x++) m_timing_sync.process(tagged_sample(), m_tail);
+        m_frame_decoder.drain(m_sink);
+
+        std::vector<rx_packet> packets;
+        packets.swap(m_packets);
+        return packets;
+    }
+}
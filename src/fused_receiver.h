@@ -0,0 +1,83 @@
+/*! \file fused_receiver.h
+ *  \brief Header file for the fused_receiver class.
+ *
+ *  The fused_receiver class runs the overlay blocks of the receiver chain as one
+ *  fused_pipeline on the caller's thread.
+ */
+
+#ifndef FUSED_RECEIVER_H
+#define FUSED_RECEIVER_H
+
+#include <complex>
+#include <vector>
+
+#include "frame_detector.h"
+#include "timing_sync.h"
+#include "fft_symbols.h"
+#include "channel_est.h"
+#include "phase_tracker.h"
+#include "frame_decoder.h"
+#include "fused_pipeline.h"
+
+namespace wno
+{
+    /*!
+     * \brief The fused_receiver class.
+     *
+     * Inputs raw complex doubles representing the base-band digitized time domain signal.
+     *
+     * Outputs vector of correctly received packets, each holding the payload (MPDU) and the
+     * stamp of the frame's STS counted from the first sample passed in.
+     *
+     * Each sample runs through frame_detector, timing_sync, fft_symbols, channel_est,
+     * phase_tracker and frame_decoder with a single call chain that the compiler inlines,
+     * so there are no threads, no buffers between the blocks and no per-block call
+     * overhead. The frame_decoder decodes the frames inline as well. Unlike the
+     * receiver_chain there is no underlay detection or cancellation.
+     */
+    class fused_receiver
+    {
+    public:
+
+        fused_receiver(); //!< Constructor for fused_receiver
+
+        /*!
+         * \brief Processes the raw time domain samples.
+         * \param samples A vector of received time-domain samples.
+         * \return A vector of correctly received packets. A packet is returned by the call that
+         *  delivered its last sample.
+         */
+        std::vector<rx_packet> process_samples(const std::vector<std::complex<double> > & samples);
+
+        /*!
+         * \brief Pushes the samples the timing_sync holds back for its LTS search through the
+         *  remaining blocks, as receiver_chain::flush() does with the samples between its
+         *  blocks, and returns the packets this completes. The frames themselves are decoded
+         *  inline, so none are still being decoded.
+         */
+        std::vector<rx_packet> flush();
+
+    private:
+
+        typedef vector_sink<rx_packet> packet_sink; //!< Sink collecting the packets
+
+        frame_detector m_frame_detector; //!< Detects start of frame using STS
+        timing_sync    m_timing_sync;    //!< Aligns frame in time using LTS & some freq correction
+        fft_symbols    m_fft_symbols;    //!< Forward FFT of symbols
+        channel_est    m_channel_est;    //!< Channel estimation and equalization in freq domain
+        phase_tracker  m_phase_tracker;  //!< Phase rotation tracking
+        frame_decoder  m_frame_decoder;  //!< Frame decoding
+
+        std::vector<rx_packet> m_packets; //!< Packets decoded during the current call
+
+        packet_sink m_sink; //!< Appends to #m_packets
+
+        //! The fused blocks
+        fused_pipeline<packet_sink, frame_detector, timing_sync, fft_symbols, channel_est, phase_tracker, frame_decoder> m_pipeline;
+
+        //! The blocks after the timing_sync, which #flush() feeds directly
+        fused_pipeline<packet_sink, fft_symbols, channel_est, phase_tracker, frame_decoder> m_tail;
+    };
+}
+
+#endif // FUSED_RECEIVER_H
@@ -0,0 +1,66 @@
+/*! \file handoff.cpp
+ *  \brief C++ file for the handoff class.
+ *
+ *  The handoff class is a counting semaphore used to hand work from one thread to
+ *  another, e.g. a chunk from one receiver block to the next, with a configurable way
+ *  of waiting for it.
+ */
+
+#include <emmintrin.h>
+
+#include "handoff.h"
+
+namespace wno
+{
+    handoff::handoff(wait_strategy strategy, int spin_count) :
+        m_count(0),
+        m_strategy(strategy),
+        m_spin_count(spin_count)
+    {
+        sem_init(&m_sem, 0, 0);
+    }
+
+    handoff::~handoff()
+    {
+        sem_destroy(&m_sem);
+    }
+
+    void handoff::post()
+    {
+        if(m_count.fetch_add(1) < 0) sem_post(&m_sem);
+    }
+
+    bool handoff::try_wait()
+    {
+        int count = m_count.load(std::memory_order_relaxed);
+        while(count > 0)
+        {
+            if(m_count.compare_exchange_weak(count, count - 1)) return true;
+        }
+        return false;
+    }
+
+    /*!
+     * The polls use the pause instruction so that a spinning waiter does not starve its
+     * hyper-threaded sibling or flood the memory bus with reads of the count.
+     */
+    void handoff::wait()
+    {
+        if(m_strategy == WAIT_BUSY_POLL)
+        {
+            while(!try_wait()) _mm_pause();
+            return;
+        }
+
+        if(m_strategy == WAIT_SPIN_THEN_BLOCK)
+        {
+            for(int x = 0; x < m_spin_count; x++)
+            {
+                if(try_wait()) return;
+                _mm_pause();
+            }
+        }
+
+        if(m_count.fetch_sub(1) <= 0) sem_wait(&m_sem);
+    }
+}
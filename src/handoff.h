@@ -0,0 +1,72 @@
+/*! \file handoff.h
+ *  \brief Header file for the handoff class.
+ *
+ *  The handoff class is a counting semaphore used to hand work from one thread to
+ *  another, e.g. a chunk from one receiver block to the next, with a configurable way
+ *  of waiting for it.
+ */
+
+#ifndef HANDOFF_H
+#define HANDOFF_H
+
+#include <atomic>
+#include <semaphore.h>
+
+#define DEFAULT_SPIN_COUNT 20000 // Polls before a WAIT_SPIN_THEN_BLOCK waiter blocks (about 10-50 us)
+
+namespace wno
+{
+    /*!
+     * \brief How a thread waits for a handoff
+     *
+     * A thread that polls keeps its core busy for as long as it lives, so the polling
+     * strategies are meant for threads that run for the whole process.
+     */
+    enum wait_strategy
+    {
+        WAIT_BLOCK,             //!< Block on the semaphore right away
+        WAIT_SPIN_THEN_BLOCK,   //!< Poll the count for a while, then block
+        WAIT_BUSY_POLL,         //!< Poll the count until it is posted, never block (needs a core of its own)
+    };
+
+    /*!
+     * \brief The handoff class.
+     *
+     * The count lives in an atomic integer and the sem_t is only used to park a waiter
+     * that found the count at zero, so neither #post() nor #wait() makes a system call
+     * when the waiter does not have to sleep. A negative count is the number of blocked
+     * waiters. A spinning or polling waiter only takes a post when the count is
+     * positive, so a post never has to wake it up.
+     */
+    class handoff
+    {
+    public:
+
+        /*!
+         * \brief Constructor for handoff
+         * \param strategy How #wait() waits for a post.
+         * \param spin_count Number of polls before blocking (WAIT_SPIN_THEN_BLOCK only).
+         */
+        handoff(wait_strategy strategy = WAIT_BLOCK, int spin_count = DEFAULT_SPIN_COUNT);
+
+        ~handoff();
+
+        void post(); //!< Increments the count, waking up a blocked waiter if there is one
+
+        void wait(); //!< Waits until the count is positive and decrements it
+
+        bool try_wait(); //!< Decrements the count if it is positive, returns false otherwise
+
+    private:
+
+        std::atomic<int> m_count; //!< Posts not waited on yet (negative: number of blocked waiters)
+
+        sem_t m_sem; //!< Blocked waiters sleep on this
+
+        wait_strategy m_strategy; //!< How #wait() waits
+
+        int m_spin_count; //!< Polls before blocking
+    };
+}
+
+#endif // HANDOFF_H
@@ -0,0 +1,64 @@
+/*! \file mirrored_ring.cpp
+ *  \brief C++ file for the mirrored_ring class template.
+ *
+ *  The mirrored_ring class keeps the most recent items a block has seen in a ring buffer
+ *  that is mapped twice back to back in virtual memory, so that the history and the new
+ *  items can always be read as one contiguous array without copying the history.
+ */
+
+#include <stdexcept>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "mirrored_ring.h"
+
+namespace wno
+{
+    /*!
+     * The memory is an anonymous memory file mapped twice into a reserved range of twice
+     * its size. The size is a multiple of the page size (so the second mapping can start
+     * right after the first) and of the granularity (so an item never straddles the end
+     * of the first copy in a way the second copy does not mirror).
+     */
+    mirrored_memory::mirrored_memory(size_t min_size, size_t granularity) :
+        m_data(NULL),
+        m_size(0)
+    {
+        size_t page = sysconf(_SC_PAGESIZE);
+        size_t unit = page;
+        while(unit % granularity) unit += page;
+        m_size = (min_size + unit - 1) / unit * unit;
+
+        int fd = memfd_create("wno_mirrored_ring", 0);
+        if(fd < 0) throw std::runtime_error("mirrored_memory: memfd_create failed");
+        if(ftruncate(fd, m_size) < 0)
+        {
+            close(fd);
+            throw std::runtime_error("mirrored_memory: ftruncate failed");
+        }
+
+        // Reserve the address range for both copies, then map the file over each half
+        char * base = static_cast<char *>(mmap(NULL, 2 * m_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+        if(base == MAP_FAILED)
+        {
+            close(fd);
+            throw std::runtime_error("mirrored_memory: address reservation failed");
+        }
+        if(mmap(base, m_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+           mmap(base + m_size, m_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+        {
+            munmap(base, 2 * m_size);
+            close(fd);
+            throw std::runtime_error("mirrored_memory: mapping failed");
+        }
+
+        // The mappings keep the memory alive
+        close(fd);
+        m_data = base;
+    }
+
+    mirrored_memory::~mirrored_memory()
+    {
+        munmap(m_data, 2 * m_size);
+    }
+}
@@ -0,0 +1,108 @@
+/*! \file mirrored_ring.h
+ *  \brief Header file for the mirrored_ring class template.
+ *
+ *  The mirrored_ring class keeps the most recent items a block has seen in a ring buffer
+ *  that is mapped twice back to back in virtual memory, so that the history and the new
+ *  items can always be read as one contiguous array without copying the history.
+ */
+
+#ifndef MIRRORED_RING_H
+#define MIRRORED_RING_H
+
+#include <cstring>
+#include <cstddef>
+
+namespace wno
+{
+    /*!
+     * \brief Memory mapped twice back to back.
+     *
+     * Byte x and byte x + #size() of #data() are the same physical memory. The memory
+     * starts zeroed.
+     */
+    class mirrored_memory
+    {
+    public:
+
+        /*!
+         * \brief Constructor for mirrored_memory
+         * \param min_size Minimum size in bytes of one copy.
+         * \param granularity The size is rounded up to a multiple of this as well as of the page size.
+         */
+        mirrored_memory(size_t min_size, size_t granularity);
+
+        /*!
+         * \brief Destructor for mirrored_memory. Unmaps both copies.
+         */
+        ~mirrored_memory();
+
+        void * data() { return m_data; } //!< Get the start of the first copy
+
+        size_t size() { return m_size; } //!< Get the size in bytes of one copy
+
+    private:
+
+        void * m_data; //!< Start of the first copy
+        size_t m_size; //!< Size in bytes of one copy
+    };
+
+    /*!
+     * \brief The mirrored_ring class template.
+     *
+     * Each call to #append() copies the new items into the ring and returns a pointer to
+     * the items preceded by the last #history() items appended before them. Since the ring
+     * is mirrored the view never wraps, so blocks needing a history of their input do not
+     * have to keep their own carryover and copy it in front of every input. The view is
+     * writable and changes to the history are seen by the next call. The history starts
+     * out as zeroed items.
+     *
+     * T must be trivially copyable.
+     */
+    template<typename T>
+    class mirrored_ring
+    {
+    public:
+
+        /*!
+         * \brief Constructor for mirrored_ring
+         * \param history Number of previous items preceding the new items in each view.
+         * \param max_count Maximum number of items appended at once.
+         */
+        mirrored_ring(size_t history, size_t max_count) :
+            m_memory((history + max_count) * sizeof(T), sizeof(T)),
+            m_items(static_cast<T *>(m_memory.data())),
+            m_capacity(m_memory.size() / sizeof(T)),
+            m_head(0),
+            m_history(history)
+        {
+        }
+
+        /*!
+         * \brief Appends items to the ring.
+         * \param items The items to append.
+         * \param count Number of items, at most the max_count the ring was created with.
+         * \return The view: #history() previous items followed by the appended items.
+         */
+        T * append(const T * items, size_t count)
+        {
+            if(count) memcpy(m_items + m_head, items, count * sizeof(T));
+            T * view = m_items + (m_head + m_capacity - m_history) % m_capacity;
+            m_head = (m_head + count) % m_capacity;
+            return view;
+        }
+
+        size_t history() { return m_history; } //!< Get the number of previous items in each view
+
+        size_t footprint() { return m_memory.size(); } //!< Get the number of bytes of memory behind the ring (mapped twice)
+
+    private:
+
+        mirrored_memory m_memory; //!< The mirrored memory holding the items
+        T * m_items; //!< Start of the ring
+        size_t m_capacity; //!< Number of items in the ring (one copy)
+        size_t m_head; //!< Index the next appended item goes to
+        size_t m_history; //!< Number of previous items in each view
+    };
+}
+
+#endif // MIRRORED_RING_H
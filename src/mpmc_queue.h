@@ -0,0 +1,128 @@
+/*! \file mpmc_queue.h
+ *  \brief Lock-free multiple producer multiple consumer queue.
+ *
+ *  The mpmc_queue class is a bounded ring buffer that lets any number of threads hand
+ *  items to any number of other threads without locks, e.g. the receiver thread passing
+ *  packets to the threads delivering them to the user.
+ */
+
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#include <atomic>
+#include <utility>
+#include <vector>
+#include <stddef.h>
+
+namespace wno
+{
+    /*!
+     * \brief The mpmc_queue class template.
+     *
+     * Each slot carries a sequence number telling whether it is free for the push or full
+     * for the pop of the current lap around the ring, so producers (and consumers) only
+     * contend on the compare-and-swap of their index. The capacity is rounded up to a power
+     * of 2. Neither #push() nor #pop() blocks, they return false instead when the queue is
+     * full or empty. Items are swapped in and out so that containers keep their storage.
+     */
+    template<typename T>
+    class mpmc_queue
+    {
+    public:
+
+        /*!
+         * \brief Constructor for mpmc_queue
+         * \param capacity Minimum number of items the queue can hold.
+         */
+        mpmc_queue(size_t capacity) :
+            m_head(0),
+            m_tail(0)
+        {
+            size_t size = 1;
+            while(size < capacity) size <<= 1;
+            m_slots = std::vector<slot>(size);
+            for(size_t x = 0; x < size; x++) m_slots[x].sequence.store(x, std::memory_order_relaxed);
+            m_mask = size - 1;
+        }
+
+        /*!
+         * \brief Adds an item to the back of the queue by swapping it with the free slot.
+         * \param item The item to add. On success it receives the previous content of the slot.
+         * \return False if the queue was full and the item was left untouched.
+         */
+        bool push(T & item)
+        {
+            size_t tail = m_tail.load(std::memory_order_relaxed);
+            while(1)
+            {
+                slot & s = m_slots[tail & m_mask];
+                ptrdiff_t lag = (ptrdiff_t)(s.sequence.load(std::memory_order_acquire) - tail);
+                if(lag == 0)
+                {
+                    if(m_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+                    {
+                        std::swap(s.item, item);
+                        s.sequence.store(tail + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if(lag < 0) return false; // The slot still holds the item of the previous lap
+                else tail = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+
+        /*!
+         * \brief Removes the item at the front of the queue by swapping it with item.
+         * \param item Set to the removed item, its previous content is left in the slot.
+         * \return False if the queue was empty.
+         */
+        bool pop(T & item)
+        {
+            size_t head = m_head.load(std::memory_order_relaxed);
+            while(1)
+            {
+                slot & s = m_slots[head & m_mask];
+                ptrdiff_t lag = (ptrdiff_t)(s.sequence.load(std::memory_order_acquire) - (head + 1));
+                if(lag == 0)
+                {
+                    if(m_head.compare_exchange_weak(head, head + 1, std::memory_order_relaxed))
+                    {
+                        std::swap(s.item, item);
+                        s.sequence.store(head + m_mask + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if(lag < 0) return false; // The slot was not filled in this lap yet
+                else head = m_head.load(std::memory_order_relaxed);
+            }
+        }
+
+        size_t capacity() const { return m_slots.size(); } //!< Get the capacity of the queue
+
+    private:
+
+        /*!
+         * \brief A slot of the ring
+         */
+        struct slot
+        {
+            std::atomic<size_t> sequence; //!< Index of the push (or of the pop minus 1) the slot is waiting for
+            T item;                       //!< The item
+
+            slot() : sequence(0) {}
+            slot(const slot & other) : sequence(other.sequence.load()), item(other.item) {}
+        };
+
+        std::vector<slot> m_slots; //!< Ring buffer of slots
+
+        size_t m_mask; //!< Capacity - 1 for wrapping the indices
+
+        std::atomic<size_t> m_head; //!< Number of pops claimed so far
+
+        char m_pad[64]; //!< Keeps the producer and consumer indices on separate cache lines
+
+        std::atomic<size_t> m_tail; //!< Number of pushes claimed so far
+    };
+}
+
+#endif // MPMC_QUEUE_H
@@ -0,0 +1,86 @@
+/*! \file packet_queue.cpp
+ *  \brief C++ file for the packet_queue class.
+ *
+ *  The packet_queue class decouples the receiver thread from the threads delivering the
+ *  received packets to the user, so that a slow consumer never stalls the demodulation.
+ */
+
+#include "packet_queue.h"
+
+namespace wno
+{
+    packet_queue::packet_queue(size_t capacity, overload_policy policy) :
+        m_packets(capacity),
+        m_policy(policy),
+        m_queued(0),
+        m_delivered(0),
+        m_dropped(0)
+    {
+    }
+
+    /*!
+     * With DROP_OLDEST the pusher pops the oldest packet itself to make room. A delivery
+     * thread may take it first, in which case the push is simply retried.
+     */
+    bool packet_queue::push(rx_packet & packet)
+    {
+        while(!m_packets.push(packet))
+        {
+            if(m_policy == DROP_NEWEST)
+            {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            if(m_policy == BLOCK)
+            {
+                m_space.wait();
+                continue;
+            }
+
+            rx_packet oldest;
+            if(m_packets.pop(oldest))
+            {
+                m_items.try_wait();
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        // The packet now holds the previous content of the slot, which the pop left empty
+        packet.payload.release();
+        m_queued.fetch_add(1, std::memory_order_relaxed);
+        if(m_policy == BLOCK) m_space.try_wait();
+        m_items.post();
+        return true;
+    }
+
+    /*!
+     * #m_items is only a hint: a delivery thread always tries the queue before waiting on
+     * it, so a post taken by another thread (or by a DROP_OLDEST pusher) costs at most a
+     * spurious wake-up, and the delivery threads never sleep while a packet is waiting.
+     */
+    void packet_queue::pop(std::vector<rx_packet> & packets)
+    {
+        rx_packet packet;
+        while(!m_packets.pop(packet)) m_items.wait();
+
+        while(1)
+        {
+            packets.push_back(rx_packet());
+            std::swap(packets.back(), packet);
+            m_delivered.fetch_add(1, std::memory_order_relaxed);
+            if(m_policy == BLOCK) m_space.post();
+
+            if(packets.size() >= MAX_DELIVERY_BATCH || !m_packets.pop(packet)) break;
+            m_items.try_wait();
+        }
+    }
+
+    delivery_stats packet_queue::stats()
+    {
+        delivery_stats stats;
+        stats.packets_queued = m_queued.load(std::memory_order_relaxed);
+        stats.packets_delivered = m_delivered.load(std::memory_order_relaxed);
+        stats.packets_dropped = m_dropped.load(std::memory_order_relaxed);
+        return stats;
+    }
+}
@@ -0,0 +1,97 @@
+/*! \file packet_queue.h
+ *  \brief Header file for the packet_queue class.
+ *
+ *  The packet_queue class decouples the receiver thread from the threads delivering the
+ *  received packets to the user, so that a slow consumer never stalls the demodulation.
+ */
+
+#ifndef PACKET_QUEUE_H
+#define PACKET_QUEUE_H
+
+#include <atomic>
+#include <vector>
+#include <stdint.h>
+
+#include "mpmc_queue.h"
+#include "handoff.h"
+#include "rx_packet.h"
+
+#define DEFAULT_PACKET_QUEUE_CAPACITY 256 // Packets waiting for delivery before the overload policy applies
+#define MAX_DELIVERY_BATCH 64             // Packets handed to the callback at once
+
+namespace wno
+{
+    /*!
+     * \brief What a packet_queue does with a packet pushed while it is full
+     */
+    enum overload_policy
+    {
+        DROP_OLDEST,    //!< Drop the oldest packet waiting for delivery to make room
+        DROP_NEWEST,    //!< Drop the packet being pushed
+        BLOCK,          //!< Wait until a delivery thread made room (the consumer can stall the receiver)
+    };
+
+    /*!
+     * \brief Counters of a packet_queue
+     */
+    struct delivery_stats
+    {
+        uint64_t packets_queued;    //!< Packets pushed into the queue
+        uint64_t packets_delivered; //!< Packets taken out by the delivery threads
+        uint64_t packets_dropped;   //!< Packets dropped by the overload policy
+    };
+
+    /*!
+     * \brief The packet_queue class.
+     *
+     * A bounded lock-free queue of packets. Any number of receiver threads may push and any
+     * number of delivery threads may pop. The packets are swapped in and out so that
+     * neither side copies them. When the queue is full the #overload_policy decides
+     * whether the oldest or the newest packet is dropped (and counted) or the pusher waits.
+     */
+    class packet_queue
+    {
+    public:
+
+        /*!
+         * \brief Constructor for packet_queue
+         * \param capacity Minimum number of packets the queue can hold.
+         * \param policy What to do with a packet pushed while the queue is full.
+         */
+        packet_queue(size_t capacity = DEFAULT_PACKET_QUEUE_CAPACITY, overload_policy policy = DROP_OLDEST);
+
+        /*!
+         * \brief Queues a packet for delivery.
+         * \param packet The packet. Its payload is left empty unless the packet was dropped.
+         *  A packet dropped to make room is destroyed, which returns its payload to the pool.
+         * \return False if the packet was dropped (DROP_NEWEST only).
+         */
+        bool push(rx_packet & packet);
+
+        /*!
+         * \brief Waits for at least one packet and takes out the packets waiting for delivery.
+         * \param packets The packets are appended to this, at most #MAX_DELIVERY_BATCH of them.
+         */
+        void pop(std::vector<rx_packet> & packets);
+
+        delivery_stats stats(); //!< Get the counters of the queue
+
+    private:
+
+        mpmc_queue<rx_packet> m_packets; //!< The packets waiting for delivery
+
+        overload_policy m_policy; //!< What to do when the queue is full
+
+        handoff m_items; //!< Posted for every packet pushed
+
+        handoff m_space; //!< Posted for every packet popped (BLOCK only)
+
+        std::atomic<uint64_t> m_queued; //!< Packets pushed
+
+        std::atomic<uint64_t> m_delivered; //!< Packets popped by the delivery threads
+
+        std::atomic<uint64_t> m_dropped; //!< Packets dropped
+    };
+}
+
+#endif // PACKET_QUEUE_H
@@ -0,0 +1,78 @@
+/*! \file payload_pool.cpp
+ *  \brief C++ file for the payload_pool and payload_buffer classes.
+ *
+ *  The payload_pool class recycles the buffers the frame_decoder writes the payloads into,
+ *  and the payload_buffer class is the move-only handle the payloads are handed up in, so
+ *  that a payload is written once and never copied or allocated on its way to the user.
+ */
+
+#include "payload_pool.h"
+
+namespace wno
+{
+    void payload_buffer::release()
+    {
+        if(m_bytes) m_pool->recycle(m_bytes);
+        m_bytes = NULL;
+        m_pool = NULL;
+    }
+
+    payload_buffer payload_buffer::clone() const
+    {
+        if(!m_bytes) return payload_buffer();
+        payload_buffer copy = m_pool->acquire();
+        copy.bytes().assign(m_bytes->begin(), m_bytes->end());
+        return copy;
+    }
+
+    payload_pool::payload_pool(size_t capacity, size_t buffer_size) :
+        m_free(capacity),
+        m_buffer_size(buffer_size),
+        m_acquired(0),
+        m_allocated(0),
+        m_freed(0)
+    {
+    }
+
+    payload_pool::~payload_pool()
+    {
+        std::vector<unsigned char> * bytes;
+        while(m_free.pop(bytes)) delete bytes;
+    }
+
+    payload_buffer payload_pool::acquire()
+    {
+        m_acquired.fetch_add(1, std::memory_order_relaxed);
+
+        std::vector<unsigned char> * bytes = NULL;
+        if(!m_free.pop(bytes))
+        {
+            bytes = new std::vector<unsigned char>();
+            bytes->reserve(m_buffer_size);
+            m_allocated.fetch_add(1, std::memory_order_relaxed);
+        }
+        return payload_buffer(bytes, this);
+    }
+
+    /*!
+     * The buffer is cleared but keeps its storage.
+     */
+    void payload_pool::recycle(std::vector<unsigned char> * bytes)
+    {
+        bytes->clear();
+        if(!m_free.push(bytes))
+        {
+            delete bytes;
+            m_freed.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    payload_pool_stats payload_pool::stats()
+    {
+        payload_pool_stats stats;
+        stats.acquired = m_acquired.load(std::memory_order_relaxed);
+        stats.allocated = m_allocated.load(std::memory_order_relaxed);
+        stats.freed = m_freed.load(std::memory_order_relaxed);
+        return stats;
+    }
+}
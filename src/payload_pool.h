@@ -0,0 +1,177 @@
+/*! \file payload_pool.h
+ *  \brief Header file for the payload_pool and payload_buffer classes.
+ *
+ *  The payload_pool class recycles the buffers the frame_decoder writes the payloads into,
+ *  and the payload_buffer class is the move-only handle the payloads are handed up in, so
+ *  that a payload is written once and never copied or allocated on its way to the user.
+ */
+
+#ifndef PAYLOAD_POOL_H
+#define PAYLOAD_POOL_H
+
+#include <atomic>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "mpmc_queue.h"
+
+#define DEFAULT_PAYLOAD_POOL_SIZE 512 // Payload buffers kept for reuse (enough for a full packet_queue and the frames in flight)
+
+namespace wno
+{
+    class payload_pool;
+
+    /*!
+     * \brief The payload_buffer class.
+     *
+     * Owns one buffer of a payload_pool until it is released, moved from or destroyed, and
+     * gives it back to the pool then. It cannot be copied, so a payload has exactly one owner
+     * on its way from the frame_decoder to the user. A default constructed handle is empty
+     * and owns no buffer.
+     */
+    class payload_buffer
+    {
+    public:
+
+        payload_buffer() : m_bytes(NULL), m_pool(NULL) {} //!< Constructor for an empty handle
+
+        /*!
+         * \brief Move constructor, other is left empty.
+         * \param other The handle to take the buffer of.
+         */
+        payload_buffer(payload_buffer && other) noexcept :
+            m_bytes(other.m_bytes),
+            m_pool(other.m_pool)
+        {
+            other.m_bytes = NULL;
+            other.m_pool = NULL;
+        }
+
+        /*!
+         * \brief Move assignment, releases the buffer held so far and leaves other empty.
+         * \param other The handle to take the buffer of.
+         */
+        payload_buffer & operator=(payload_buffer && other) noexcept
+        {
+            if(this != &other)
+            {
+                release();
+                m_bytes = other.m_bytes;
+                m_pool = other.m_pool;
+                other.m_bytes = NULL;
+                other.m_pool = NULL;
+            }
+            return *this;
+        }
+
+        ~payload_buffer() { release(); }
+
+        void release(); //!< Gives the buffer back to its pool, leaving the handle empty
+
+        /*!
+         * \brief Gets a new handle holding a copy of the payload from the same pool. The
+         *  only way to copy a payload, so that copies are never made by accident.
+         */
+        payload_buffer clone() const;
+
+        bool empty() const { return !m_bytes || m_bytes->empty(); } //!< Whether there is no payload
+        size_t size() const { return m_bytes ? m_bytes->size() : 0; } //!< Payload length in bytes
+        const unsigned char * data() const { return m_bytes ? m_bytes->data() : NULL; } //!< The payload's bytes
+        const unsigned char & operator[](size_t x) const { return (*m_bytes)[x]; } //!< Byte x of the payload
+        const unsigned char * begin() const { return data(); } //!< First byte of the payload
+        const unsigned char * end() const { return data() + size(); } //!< Past the last byte of the payload
+
+        /*!
+         * \brief Gets the buffer to write the payload into. Must not be called on an empty
+         *  handle. Writing within the pool's buffer size does not allocate.
+         */
+        std::vector<unsigned char> & bytes() { return *m_bytes; }
+
+    private:
+
+        friend class payload_pool;
+
+        /*!
+         * \brief Constructor for a handle owning a buffer, used by the pool.
+         * \param bytes The buffer.
+         * \param pool The pool the buffer goes back to.
+         */
+        payload_buffer(std::vector<unsigned char> * bytes, payload_pool * pool) :
+            m_bytes(bytes),
+            m_pool(pool)
+        {
+        }
+
+        payload_buffer(const payload_buffer &);             //!< Not copyable, see #clone()
+        payload_buffer & operator=(const payload_buffer &); //!< Not copyable, see #clone()
+
+        std::vector<unsigned char> * m_bytes; //!< The buffer (NULL if empty)
+        payload_pool * m_pool;                //!< The pool the buffer goes back to (NULL if empty)
+    };
+
+    /*!
+     * \brief Counters of a payload_pool
+     */
+    struct payload_pool_stats
+    {
+        uint64_t acquired;  //!< Buffers handed out
+        uint64_t allocated; //!< Buffers allocated because none was free
+        uint64_t freed;     //!< Buffers deleted because the pool was full when they came back
+    };
+
+    /*!
+     * \brief The payload_pool class.
+     *
+     * Keeps the free buffers in a lock-free mpmc_queue so that the decoder workers can take
+     * them and the user's threads can give them back concurrently. A buffer is only allocated
+     * when none is free, with room for the largest payload so that it is never reallocated,
+     * and only deleted when more come back than the pool holds. Once as many buffers as are
+     * in flight at once came back, taking and releasing them does not allocate. The pool must
+     * outlive the handles it hands out.
+     */
+    class payload_pool
+    {
+    public:
+
+        /*!
+         * \brief Constructor for payload_pool
+         * \param capacity Minimum number of free buffers the pool keeps.
+         * \param buffer_size Bytes reserved in every buffer, i.e. the largest payload.
+         */
+        payload_pool(size_t capacity = DEFAULT_PAYLOAD_POOL_SIZE, size_t buffer_size = 0);
+
+        ~payload_pool();
+
+        /*!
+         * \brief Takes a free buffer, or allocates one if there is none. May be called from
+         *  any thread.
+         * \return A handle holding the buffer, which is empty (size 0).
+         */
+        payload_buffer acquire();
+
+        payload_pool_stats stats(); //!< Get the counters of the pool
+
+    private:
+
+        friend class payload_buffer;
+
+        /*!
+         * \brief Takes a buffer back from a handle. May be called from any thread.
+         * \param bytes The buffer.
+         */
+        void recycle(std::vector<unsigned char> * bytes);
+
+        mpmc_queue<std::vector<unsigned char> *> m_free; //!< The free buffers
+
+        size_t m_buffer_size; //!< Bytes reserved in every buffer
+
+        std::atomic<uint64_t> m_acquired; //!< Buffers handed out
+
+        std::atomic<uint64_t> m_allocated; //!< Buffers allocated
+
+        std::atomic<uint64_t> m_freed; //!< Buffers deleted
+    };
+}
+
+#endif // PAYLOAD_POOL_H
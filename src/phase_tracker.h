@@ -33,12 +33,37 @@ namespace wno
     {
     public:
 
-        phase_tracker(); //!< Constructor for phase_tracker block.
+        /*!
+         * \brief Constructor for phase_tracker block.
+         * \param max_input Most symbols per call to work().
+         */
+        phase_tracker(size_t max_input = SYMBOL_BUFFER_MAX);
 
         virtual void work(); //!< Signal processing happens here.
 
+        /*!
+         * \brief Processes one symbol.
+         * \param symbol The input symbol.
+         * \param sink Called with the corrected data subcarriers of the symbol.
+         */
+        template<typename Sink>
+        void process(const tagged_vector<64> & symbol, Sink & sink);
+
     private:
 
+        /*! \brief The polarity of the pilot subcarriers beginning with the pilots of
+         * the SIGNAL symbol being multiplied by POLARITY[0], then the next symbol
+         * being multiplied by POLARITY[1] and so on.
+         */
+        static const double POLARITY[127];
+
+        /*! \brief The index of each pilot in the 64 sample symbol and its
+         * initial value before being multiplied by its corresponding polarity
+         */
+        static const int PILOTS[4][2];
+
+        static const int DATA_SUBCARRIERS[48]; //!< The indicies of the 48 data subcarriers in the 64 sample symbol
+
         /*!
          * \brief Counter used to keep track of the symbol number in the frame so
          * as to know what pilot polarity to expect. This is reset at the beginning
@@ -47,6 +72,55 @@ namespace wno
         int m_symbol_count;
 
     };
+
+    /*!
+     * This block uses the pilot symbols to estimate phase rotation of each symbol on a per symbol basis
+     * The phase rotation of each pilot symbol is calculated then averaged together. The inverse of this
+     * rotation is the applied to each symbol. This is a fair assumption since the pilot symbols are evenly
+     * dispersed throughout the symbol.
+     *
+     * The squared error of the corrected pilots is passed on with each symbol.
+     */
+    template<typename Sink>
+    inline void phase_tracker::process(const tagged_vector<64> & symbol, Sink & sink)
+    {
+        if(symbol.tag == START_OF_FRAME)
+        {
+            m_symbol_count = 0; // Reset the symbol count
+        }
+
+        // Calculate the phase error of this symbol based on the pilots
+        std::complex<double> phase_error = std::complex<double>(0,0);
+        for(int p = 0; p < 4; p++)
+        {
+            int pilot = PILOTS[p][1] * POLARITY[m_symbol_count % 127];
+            std::complex<double> ref_pilot_sample = std::complex<double>(pilot, 0);
+            std::complex<double> rec_pilot_sample = symbol.samples[PILOTS[p][0]];
+            phase_error += rec_pilot_sample * std::conj(ref_pilot_sample) / 4.0;
+        }
+
+        double angle = std::arg(phase_error);
+        std::complex<double> correction(std::cos(-angle), std::sin(-angle));
+
+        // Apply the phase correction to the data samples
+        tagged_vector<48> out(symbol.tag);
+        out.frame = symbol.frame;
+
+        // What is left of the pilots' error after the correction is noise (for the EVM of the frame)
+        for(int p = 0; p < 4; p++)
+        {
+            int pilot = PILOTS[p][1] * POLARITY[m_symbol_count % 127];
+            out.pilot_error += std::norm(symbol.samples[PILOTS[p][0]] * correction - std::complex<double>(pilot, 0));
+        }
+        for(int s = 0; s < 48; s++)
+        {
+            int index = DATA_SUBCARRIERS[s];
+            out.samples[s] = symbol.samples[index] * correction;
+        }
+
+        m_symbol_count++; //Keep track of the current symbol number in the frame
+        sink(out);
+    }
 }
 
 #endif // PHASE_TRACKER_H
@@ -0,0 +1,111 @@
+/*! \file pn_correlator.cpp
+ *  \brief C++ file for the pn_correlator class.
+ *
+ *  The pn_correlator class is a wrapper on the fftw3 library that cross correlates
+ *  a stream of samples against one or more known PN sequences at every sample offset
+ *  using the overlap-save method.
+ */
+
+#include <cstring>
+#include <algorithm>
+#include <assert.h>
+
+#include "pn_correlator.h"
+
+namespace wno
+{
+    pn_correlator::pn_correlator(const std::vector<std::complex<double> > & pn, int fft_length) :
+        pn_correlator(std::vector<std::vector<std::complex<double> > >(1, pn), fft_length)
+    {
+    }
+
+    /*!
+     * -Initializations:
+     *  + #m_fft_length -> fft_length
+     *  + #m_pn_length -> length of the longest PN sequence
+     *  + #m_step -> fft_length - pn_length + 1
+     *  + #m_first_code -> {0}
+     *
+     * Each PN sequence is zero-padded to the FFT length and transformed once here so that
+     * each call to #correlate() only costs one forward FFT per #m_step outputs plus one
+     * complex multiply per bin and one inverse FFT per code.
+     */
+    pn_correlator::pn_correlator(const std::vector<std::vector<std::complex<double> > > & codes, int fft_length) :
+        m_fft_length(fft_length),
+        m_pn_length(0),
+        m_pn_spectra(codes.size(), std::vector<std::complex<double> >(fft_length)),
+        m_first_code(1, 0)
+    {
+        for(int c = 0; c < codes.size(); c++) m_pn_length = std::max(m_pn_length, (int)codes[c].size());
+        m_step = m_fft_length - m_pn_length + 1;
+        assert(codes.size() > 0 && m_pn_length > 0 && m_step > 0);
+
+        // Allocate the FFT buffers
+        m_fftw_in = (fftw_complex *)fftw_malloc(sizeof(fftw_complex) * m_fft_length);
+        m_fftw_spectrum = (fftw_complex *)fftw_malloc(sizeof(fftw_complex) * m_fft_length);
+        m_fftw_product = (fftw_complex *)fftw_malloc(sizeof(fftw_complex) * m_fft_length);
+        m_fftw_out = (fftw_complex *)fftw_malloc(sizeof(fftw_complex) * m_fft_length);
+        m_fftw_plan_forward = fftw_plan_dft_1d(m_fft_length, m_fftw_in, m_fftw_spectrum, FFTW_FORWARD, FFTW_MEASURE);
+        m_fftw_plan_inverse = fftw_plan_dft_1d(m_fft_length, m_fftw_product, m_fftw_out, FFTW_BACKWARD, FFTW_MEASURE);
+
+        // sum(x[n+k] * pn[k]) = IFFT(FFT(x) * sum(pn[k] * exp(+j*2*pi*m*k/L)))
+        // which is exactly the (unscaled) backward transform of the zero-padded PN sequence
+        for(int c = 0; c < codes.size(); c++)
+        {
+            memset(m_fftw_product, 0, m_fft_length * sizeof(fftw_complex));
+            memcpy(m_fftw_product, &codes[c][0], codes[c].size() * sizeof(std::complex<double>));
+            fftw_execute(m_fftw_plan_inverse);
+            memcpy(&m_pn_spectra[c][0], m_fftw_out, m_fft_length * sizeof(std::complex<double>));
+            for(int m = 0; m < m_fft_length; m++) m_pn_spectra[c][m] /= m_fft_length;
+        }
+    }
+
+    pn_correlator::~pn_correlator()
+    {
+        fftw_destroy_plan(m_fftw_plan_forward);
+        fftw_destroy_plan(m_fftw_plan_inverse);
+        fftw_free(m_fftw_in);
+        fftw_free(m_fftw_spectrum);
+        fftw_free(m_fftw_product);
+        fftw_free(m_fftw_out);
+    }
+
+    void pn_correlator::correlate(const std::complex<double> * samples, int num_outputs, std::complex<double> * output)
+    {
+        correlate(samples, num_outputs, m_first_code, &output);
+    }
+
+    /*!
+     * Steps through the samples #m_step outputs at a time. Each step transforms the next
+     * #m_fft_length samples (zero-padding past the end of the available samples) and then,
+     * for each code, multiplies by the pre-computed PN spectrum, transforms back and keeps
+     * the first #m_step outputs which are free of circular wrap-around. The last
+     * pn_length - 1 samples of each step are re-used as the start of the next one.
+     */
+    void pn_correlator::correlate(const std::complex<double> * samples, int num_outputs, const std::vector<int> & codes, std::complex<double> * const * outputs)
+    {
+        int num_samples = num_outputs + m_pn_length - 1;
+        std::complex<double> * in = reinterpret_cast<std::complex<double> *>(m_fftw_in);
+        std::complex<double> * spectrum = reinterpret_cast<std::complex<double> *>(m_fftw_spectrum);
+        std::complex<double> * product = reinterpret_cast<std::complex<double> *>(m_fftw_product);
+        std::complex<double> * out = reinterpret_cast<std::complex<double> *>(m_fftw_out);
+
+        for(int x = 0; x < num_outputs; x += m_step)
+        {
+            int count = std::min(m_fft_length, num_samples - x);
+            memcpy(in, &samples[x], count * sizeof(std::complex<double>));
+            if(count < m_fft_length) memset(&in[count], 0, (m_fft_length - count) * sizeof(std::complex<double>));
+
+            fftw_execute(m_fftw_plan_forward);
+
+            for(int c = 0; c < codes.size(); c++)
+            {
+                const std::complex<double> * pn_spectrum = &m_pn_spectra[codes[c]][0];
+                for(int m = 0; m < m_fft_length; m++) product[m] = spectrum[m] * pn_spectrum[m];
+                fftw_execute(m_fftw_plan_inverse);
+
+                memcpy(&outputs[c][x], out, std::min(m_step, num_outputs - x) * sizeof(std::complex<double>));
+            }
+        }
+    }
+}
@@ -0,0 +1,120 @@
+/*! \file pn_correlator.h
+ *  \brief Header file for the pn_correlator class.
+ *
+ *  The pn_correlator class is a wrapper on the fftw3 library that cross correlates
+ *  a stream of samples against one or more known PN sequences at every sample offset
+ *  using the overlap-save method.
+ */
+
+#ifndef PN_CORRELATOR_H
+#define PN_CORRELATOR_H
+
+#include <complex>
+#include <fftw3.h>
+#include <vector>
+
+namespace wno
+{
+    /*!
+     * \brief The pn_correlator class
+     *
+     * Computes the (un-normalized) cross correlation
+     * ~~~{.cpp}
+     * output[x] = sum(samples[x+k] * pn[k]) for k = 0 .. pn_length-1
+     * ~~~
+     * for a run of consecutive offsets x. Each FFT of #m_fft_length samples yields
+     * #m_fft_length - pn_length + 1 valid outputs, the remaining pn_length - 1 samples
+     * being the overlap (history) shared with the next FFT.
+     *
+     * Several codes can be correlated against the same samples. The forward FFT of the
+     * samples is shared so each additional code only costs one spectrum multiply and one
+     * inverse FFT. pn_length is then the length of the longest code.
+     */
+    class pn_correlator
+    {
+    public:
+
+        /*!
+         * \brief Constructor for pn_correlator
+         * \param pn The PN sequence to correlate against.
+         * \param fft_length Length of the FFTs used for the overlap-save method.
+         *  Must be greater than the length of the PN sequence.
+         */
+        pn_correlator(const std::vector<std::complex<double> > & pn, int fft_length);
+
+        /*!
+         * \brief Constructor for pn_correlator with several codes
+         * \param codes The PN sequences to correlate against.
+         * \param fft_length Length of the FFTs used for the overlap-save method.
+         *  Must be greater than the length of the longest PN sequence.
+         */
+        pn_correlator(const std::vector<std::vector<std::complex<double> > > & codes, int fft_length);
+
+        /*!
+         * \brief Destructor for pn_correlator. Frees the fftw3 buffers and plans.
+         */
+        ~pn_correlator();
+
+        /*!
+         * \brief Correlates the PN sequence against num_outputs consecutive windows.
+         * \param samples Pointer to the first sample of the first window. Must point to
+         *  at least num_outputs + pn_length - 1 contiguous samples.
+         * \param num_outputs Number of window offsets to correlate.
+         * \param output Array of at least num_outputs complex doubles where the correlation
+         *  of the window starting at samples[x] is placed in output[x].
+         */
+        void correlate(const std::complex<double> * samples, int num_outputs, std::complex<double> * output);
+
+        /*!
+         * \brief Correlates a subset of the codes against num_outputs consecutive windows.
+         * \param samples Pointer to the first sample of the first window. Must point to
+         *  at least num_outputs + pn_length - 1 contiguous samples.
+         * \param num_outputs Number of window offsets to correlate.
+         * \param codes Indices of the codes to correlate.
+         * \param outputs One array of at least num_outputs complex doubles per entry of codes
+         *  where the correlation of the window starting at samples[x] is placed in outputs[i][x].
+         */
+        void correlate(const std::complex<double> * samples, int num_outputs, const std::vector<int> & codes, std::complex<double> * const * outputs);
+
+        int pn_length() { return m_pn_length; } //!< Get the length of the longest PN sequence
+
+        int num_codes() { return m_pn_spectra.size(); } //!< Get the number of PN sequences
+
+    private:
+
+        pn_correlator(const pn_correlator &) = delete;             //!< Not copyable (owns fftw3 buffers and plans)
+        pn_correlator & operator=(const pn_correlator &) = delete; //!< Not copyable (owns fftw3 buffers and plans)
+
+        int m_fft_length; //!< Length of each FFT
+
+        int m_pn_length; //!< Length of the longest PN sequence
+
+        /*!
+         * \brief Number of valid correlation outputs produced by each FFT
+         * (#m_fft_length - #m_pn_length + 1)
+         */
+        int m_step;
+
+        /*!
+         * \brief Spectrum of each zero-padded PN sequence arranged so that multiplying it with
+         *  the spectrum of the input yields the correlation. Pre-scaled by 1/#m_fft_length.
+         */
+        std::vector<std::vector<std::complex<double> > > m_pn_spectra;
+
+        std::vector<int> m_first_code; //!< Code list {0} passed on by the single code #correlate()
+
+        fftw_complex * m_fftw_in;      //!< Time domain input buffer for use by fftw3 library.
+
+        fftw_complex * m_fftw_spectrum; //!< Spectrum of the input for use by fftw3 library.
+
+        fftw_complex * m_fftw_product; //!< Spectrum of the input times a PN spectrum for use by fftw3 library.
+
+        fftw_complex * m_fftw_out;     //!< Time domain correlation buffer for use by fftw3 library.
+
+        fftw_plan m_fftw_plan_forward; //!< Forward FFT plan for use by fftw3 library.
+
+        fftw_plan m_fftw_plan_inverse; //!< Inverse FFT plan for use by fftw3 library.
+    };
+}
+
+#endif // PN_CORRELATOR_H
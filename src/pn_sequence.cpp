@@ -0,0 +1,43 @@
+/*! \file pn_sequence.cpp
+ *  \brief C++ file for the pn_sequence class.
+ *
+ *  The pn_sequence class generates the +/-1 PN sequences used by the underlay with a
+ *  linear feedback shift register instead of storing them as tables.
+ */
+
+#include "pn_sequence.h"
+
+namespace wno
+{
+    /*!
+     * The register holds the last degree bits with the oldest one in bit 0, so bit k is
+     * the chip degree - k positions back. The taps are mirrored accordingly and the
+     * feedback bit is the parity of the tapped bits.
+     */
+    pn_sequence::pn_sequence(int length, uint64_t taps, uint64_t seed) :
+        m_chips(length),
+        m_real(length),
+        m_bits((length + 63) / 64, 0)
+    {
+        int degree = 64;
+        while(degree > 1 && !(taps >> (degree - 1) & 1)) degree--;
+
+        uint64_t mask = 0;
+        for(int k = 0; k < degree; k++)
+        {
+            if(taps >> k & 1) mask |= uint64_t(1) << (degree - 1 - k);
+        }
+
+        uint64_t state = seed;
+        for(int x = 0; x < length; x++)
+        {
+            int bit = state & 1;
+            m_real[x] = bit ? 1.0 : -1.0;
+            m_chips[x] = std::complex<double>(m_real[x], 0);
+            if(!bit) m_bits[x / 64] |= uint64_t(1) << (x % 64);
+
+            uint64_t feedback = __builtin_parityll(state & mask);
+            state = (state >> 1) | (feedback << (degree - 1));
+        }
+    }
+}
@@ -0,0 +1,66 @@
+/*! \file pn_sequence.h
+ *  \brief Header file for the pn_sequence class.
+ *
+ *  The pn_sequence class generates the +/-1 PN sequences used by the underlay with a
+ *  linear feedback shift register instead of storing them as tables.
+ */
+
+#ifndef PN_SEQUENCE_H
+#define PN_SEQUENCE_H
+
+#include <complex>
+#include <vector>
+#include <stdint.h>
+
+#define DEFAULT_PN_LENGTH 2048 //!< Length of the underlay PN sequence used by default
+
+#define SPNS_TAPS  0x2580C0 //!< Feedback taps of the SPNS register (bits 6, 7, 15, 16, 18 & 21)
+#define SPNS_SEED  0x35C881 //!< First 22 chips of SPNS (bit k is chip k, 1 for +1)
+
+namespace wno
+{
+    /*!
+     * \brief The pn_sequence class.
+     *
+     * Generates length chips of the Fibonacci LFSR recurrence
+     * ~~~{.cpp}
+     * s[i] = XOR of s[i-k-1] for every bit k set in taps
+     * ~~~
+     * starting from seed, which holds the first degree bits (the degree being the highest
+     * tap + 1). Bit 1 is mapped to chip +1 and bit 0 to chip -1. With a primitive
+     * polynomial the sequence is an m-sequence of period 2^degree - 1, a longer length
+     * simply keeps running the register. The defaults reproduce the SPNS sequence.
+     *
+     * The sequence is generated once in the constructor and kept in three forms: complex
+     * chips for the correlators, real chips for vectorized adds and the chips packed 64
+     * per word (1 for -1) for the 1-bit correlators.
+     */
+    class pn_sequence
+    {
+    public:
+
+        /*!
+         * \brief Constructor for pn_sequence
+         * \param length Number of chips.
+         * \param taps Feedback taps, bit k taps the chip k + 1 positions back.
+         * \param seed The first chips of the sequence, bit k is chip k.
+         */
+        pn_sequence(int length = DEFAULT_PN_LENGTH, uint64_t taps = SPNS_TAPS, uint64_t seed = SPNS_SEED);
+
+        int length() const { return m_real.size(); } //!< Get the number of chips
+
+        const std::vector<std::complex<double> > & chips() const { return m_chips; } //!< Get the chips as complex doubles
+
+        const std::vector<double> & real() const { return m_real; } //!< Get the chips as doubles
+
+        const std::vector<uint64_t> & bits() const { return m_bits; } //!< Get the chips packed 64 per word (1 for -1)
+
+    private:
+
+        std::vector<std::complex<double> > m_chips; //!< Chips as complex doubles
+        std::vector<double> m_real; //!< Chips as doubles
+        std::vector<uint64_t> m_bits; //!< Chips packed 64 per word
+    };
+}
+
+#endif // PN_SEQUENCE_H
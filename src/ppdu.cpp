@@ -23,23 +23,23 @@ namespace wno
     /*!
      * This constructor creates an empty PPDU with the default/empty plcp_header constructor
      */
-    ppdu::ppdu()
+    ppdu::ppdu() :
+        path_metric(0)
     {
         header = plcp_header();
-        payload.reserve(MAX_FRAME_SIZE);
     }
 
     /*!
      * This constructor creates a PPDU with a header, but no payload field.
      */
-    ppdu::ppdu(Rate rate, int length)
+    ppdu::ppdu(Rate rate, int length) :
+        path_metric(0)
     {
         RateParams rate_params = RateParams(rate);
         int num_symbols = std::ceil(
                 double((16 /* service */ + 8 * (length + 4 /* CRC */) + 6 /* tail */)) /
                 double(rate_params.dbps));
         header = plcp_header(rate, length, num_symbols);
-        payload.reserve(MAX_FRAME_SIZE);
     }
 
 
@@ -47,7 +47,8 @@ namespace wno
      * This constructor creates a complete PPDU with header and payload.
      */
     ppdu::ppdu(std::vector<unsigned char> payload, Rate rate) :
-        payload(payload)
+        payload(payload),
+        path_metric(0)
     {
         RateParams rate_params = RateParams(rate);
         int length = payload.size();
@@ -221,6 +222,15 @@ namespace wno
 
 
     bool ppdu::decode_data(std::vector<std::complex<double> > samples)
+    {
+        return decode_data(samples, payload);
+    }
+
+    /*!
+     * The payload is written straight into out. Its storage is reused, so a buffer with
+     * room for MAX_FRAME_SIZE bytes is never reallocated.
+     */
+    bool ppdu::decode_data(const std::vector<std::complex<double> > & samples, std::vector<unsigned char> & out)
     {
         // Get the RateParams
         RateParams rate_params = RateParams(header.rate);
@@ -251,6 +261,7 @@ namespace wno
         std::vector<unsigned char> decoded(data_bytes);
         viterbi v;
         v.conv_decode(&depunctured[0], &decoded[0], data_bits);
+        path_metric = v.path_metric();
 
         // Descramble the data
         std::vector<unsigned char> descrambled(num_data_bytes+1, 0);
@@ -281,8 +292,7 @@ namespace wno
         {
             // Copy the payload
     //        std::vector<unsigned char> payload(length);
-            payload.resize(header.length);
-            memcpy(&payload[0], &decoded[2 /* skip the service field */], header.length);
+            out.assign(&decoded[2 /* skip the service field */], &decoded[2 + header.length]);
 
             // Fill the output values
     //        data_out.rate = rate;
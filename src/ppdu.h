@@ -139,16 +139,27 @@ namespace wno
          */
         bool decode_data(std::vector<std::complex<double> > samples);
 
+        /*!
+         * \brief Same as #decode_data() with the payload written into out instead of the
+         *  object's #payload field.
+         * \param samples Complex samples representing the encoded payload symbols.
+         * \param out Set to the decoded payload/MPDU if the CRC passed, untouched otherwise.
+         * \return Whether the CRC passed.
+         */
+        bool decode_data(const std::vector<std::complex<double> > & samples, std::vector<unsigned char> & out);
+
 
         Rate get_rate(){return header.rate;}     //!< Get this PPDU's PHY tx rate
         int get_length(){return header.length;}  //!< Get this PPDU's payload length
         int get_num_symbols(){return header.num_symbols;} //!< Get the number of OFDM symbols in this PPDU
         std::vector<unsigned char> get_payload(){return payload;} //!< Get the payload of this PPDU.
+        unsigned int get_path_metric(){return path_metric;} //!< Get the Viterbi path metric of the last decode_data() (lower is better)
 
     private:
 
         plcp_header header; //!< This PPDU's header parameters
         std::vector<unsigned char> payload; //!< This PPDU's payload
+        unsigned int path_metric; //!< Viterbi path metric of the decoded data
 
         /*!
          * \brief Encodes this PPDU's header. The header is always encoded with
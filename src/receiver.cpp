@@ -5,6 +5,9 @@
  *  This is the easiest way to start receiving 802.11a OFDM frames out of the box.
  */
 
+#include <iostream>
+#include <pthread.h>
+
 #include "receiver.h"
 
 namespace wno
@@ -13,7 +16,7 @@ namespace wno
     /*!
      * This constructor shows exactly what parameters need to be set for the receiver.
      */
-    receiver::receiver(void (*callback)(std::vector<std::vector<unsigned char> > packets), double freq, double samp_rate, double rx_gain, std::string device_addr) :
+    receiver::receiver(void (*callback)(std::vector<rx_packet> & packets), double freq, double samp_rate, double rx_gain, std::string device_addr) :
         receiver(callback, usrp_params(freq, samp_rate, 20, rx_gain, 1.0, device_addr))
     {
     }
@@ -21,36 +24,52 @@ namespace wno
     /*!
      * This constructor is for those who feel more comfortable using the usrp_params struct.
      */
-    receiver::receiver(void (*callback)(std::vector<std::vector<unsigned char> > packets), usrp_params params) :
+    receiver::receiver(void (*callback)(std::vector<rx_packet> & packets), usrp_params params, delivery_params delivery) :
         m_usrp(params),
+        m_capture_ring(CAPTURE_RING_CHUNKS, NUM_RX_SAMPLES),
+        m_packet_queue(delivery.queue_capacity, delivery.policy),
         m_samples(NUM_RX_SAMPLES),
         m_callback(callback),
-        m_rec_chain()
+        m_underlay_callback(NULL),
+        m_rec_chain(chain_params(false, LOCK_STEP, 4, 0, NULL, WAIT_BLOCK, DEFAULT_SPIN_COUNT, DEFAULT_DECODE_WORKERS, NUM_RX_SAMPLES))
     {
-        sem_init(&m_pause, 0, 1); //Initial value is 1 so that the receiver_chain_loop() will begin executing immediately
+        m_sample_rate = m_usrp.get_rx_rate();
+        m_capture_ring.set_sample_rate(m_sample_rate);
+        sem_init(&m_pause, 0, 1); //Initial value is 1 so that the capture_loop() will begin executing immediately
+        for(int x = 0; x < delivery.num_threads; x++) m_delivery_threads.push_back(std::thread(&receiver::delivery_loop, this));
         m_rec_thread = std::thread(&receiver::receiver_chain_loop, this); //Initialize the main receiver thread
+        m_capture_thread = std::thread(&receiver::capture_loop, this); //Initialize the capture thread
     }
 
     /*!
-     *  This function loops forever (unless it is paused) pulling samples from the USRP and passing them through the
-     *  receiver chain. It then passes any successfully decoded packets to the callback function for the user
-     *  to process further. This function can be paused by the user by calling the receiver::pause() function,
+     *  This function loops forever (unless it is paused) pulling samples from the USRP straight into the
+     *  chunks of the capture ring. It can be paused by the user by calling the receiver::pause() function,
      *  presumably so that the user can transmit packets over the air using the transmitter. Once the user is finished
      *  transmitting he/she can resume the receiver by called the receiver::resume() function. These two functions use
-     *  an internal semaphore to block the receiver code execution while in the paused state.
+     *  an internal semaphore to block the capture code execution while in the paused state.
+     *
+     *  Each chunk is published with the device time of its first sample.
+     *
+     *  The thread asks for real-time priority first, which needs the right privileges (e.g. sudo).
      */
-    void receiver::receiver_chain_loop()
+    void receiver::capture_loop()
     {
+        struct sched_param sched;
+        sched.sched_priority = sched_get_priority_max(SCHED_RR);
+        if(pthread_setschedparam(pthread_self(), SCHED_RR, &sched) != 0)
+        {
+            std::cout << "Unable to set realtime priority for the capture thread. Did you forget to sudo?" << std::endl;
+        }
+
         while(1)
         {
             sem_wait(&m_pause); // Block if the receiver is paused
 
-            m_usrp.get_samples(NUM_RX_SAMPLES, m_samples);
-
-            std::vector<std::vector<unsigned char> > packets =
-                    m_rec_chain.process_samples(m_samples);
-
-            m_callback(packets);
+            double time;
+            bool overflow;
+            size_t count = m_usrp.get_samples(NUM_RX_SAMPLES, m_capture_ring.write_chunk(), time, overflow);
+            if(overflow) m_capture_ring.overflow();
+            m_capture_ring.publish(count, time);
 
             sem_post(&m_pause); // Flags the end of this loop and wakes up any other threads waiting on this semaphore
                                 // i.e. a call to the pause() function in the main thread.
@@ -58,7 +77,62 @@ namespace wno
     }
 
     /*!
-     *  Uses an internal semaphore to block the execution of the receiver loop code effectively pausing
+     *  This function loops forever taking the captured samples from the capture ring and passing them through the
+     *  receiver chain. It then queues any successfully decoded packets for the delivery threads.
+     *  The chunks go in with their stamps so that the packets are stamped with the absolute index
+     *  and device time of their frame. The chunks, the packets and their payloads are swapped or
+     *  moved from ring to ring, so nothing is copied or allocated per chunk or per packet.
+     */
+    void receiver::receiver_chain_loop()
+    {
+        while(1)
+        {
+            sample_stamp stamp;
+            while(!m_capture_ring.pop(m_samples, stamp)) m_capture_ring.wait_items();
+
+            m_rec_chain.process_samples(m_samples, stamp, m_sample_rate, m_packets);
+
+            for(int x = 0; x < m_packets.size(); x++) m_packet_queue.push(m_packets[x]);
+            m_packets.clear();
+
+            void (*underlay_callback)(underlay_event event) = m_underlay_callback;
+            if(underlay_callback)
+            {
+                underlay_event event;
+                while(m_rec_chain.poll_underlay_event(event)) underlay_callback(event);
+            }
+        }
+    }
+
+    /*!
+     *  This function loops forever passing the queued packets to the callback function for the user to
+     *  process further. The callback gets the thread's recycled vector of packets, and the payloads
+     *  it did not take go back to the pool when the vector is cleared.
+     */
+    void receiver::delivery_loop()
+    {
+        std::vector<rx_packet> packets;
+        packets.reserve(MAX_DELIVERY_BATCH);
+        while(1)
+        {
+            m_packet_queue.pop(packets);
+            m_callback(packets);
+            packets.clear();
+        }
+    }
+
+    /*!
+     *  On top of the chunks in the capture ring there is the one being filled by the capture thread
+     *  and the one being processed by the receiver thread.
+     */
+    size_t receiver::buffer_footprint()
+    {
+        capture_stats stats = m_capture_ring.stats();
+        return m_rec_chain.buffer_footprint() + (stats.capacity + 2) * stats.chunk_size * sizeof(std::complex<double>);
+    }
+
+    /*!
+     *  Uses an internal semaphore to block the execution of the capture loop code effectively pausing
      *  the receiver until the semaphore is posted to (cleared) by the receiver::resume() function.
      */
     void receiver::pause()
@@ -68,7 +142,7 @@ namespace wno
 
     /*!
      *  This function posts to (clears) the internal semaphore that is blocking the receiver loop code execution
-     *  due to a previous call to the receiver::pause() function, thus allowing the main receiver loop to begin
+     *  due to a previous call to the receiver::pause() function, thus allowing the capture loop to begin
      *  executing again.
      */
     void receiver::resume()
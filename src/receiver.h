@@ -8,25 +8,65 @@
 #ifndef RECEIVER_H
 #define RECEIVER_H
 
+#include <atomic>
 #include <semaphore.h>
 #include <vector>
 #include "receiver_chain.h"
+#include "capture_ring.h"
+#include "packet_queue.h"
 #include "usrp.h"
 
 #define NUM_RX_SAMPLES 4096
+#define CAPTURE_RING_CHUNKS 256 // Chunks of NUM_RX_SAMPLES the capture ring holds (about 0.2 s at 5 Msps)
 
 namespace wno
 {
+    /*!
+     * \brief Parameters of the delivery of the received packets to the user.
+     */
+    struct delivery_params
+    {
+        int num_threads;            //!< Number of threads calling the callback (with more than one the calls overlap and may be out of order)
+        size_t queue_capacity;      //!< Number of packets waiting for delivery before the policy applies
+        overload_policy policy;     //!< What to do with a packet received while the queue is full
+
+        /*!
+         * \brief Constructor for delivery_params. Simply initializes member fields to be looked up later.
+         * \param num_threads -> #num_threads
+         * \param queue_capacity -> #queue_capacity
+         * \param policy -> #policy
+         */
+        delivery_params(int num_threads = 1, size_t queue_capacity = DEFAULT_PACKET_QUEUE_CAPACITY, overload_policy policy = DROP_OLDEST) :
+            num_threads(num_threads),
+            queue_capacity(queue_capacity),
+            policy(policy)
+        {
+        }
+    };
 
     /*!
      * \brief The receiver class is the public interface for the wno_ofdm receiver.
      *  This is the easiest way to start receiving 802.11a OFDM frames out of the box.
      *
      *  Usage: To receive packets simply create a receiver object and pass it a callback
-     *  function that takes a std::vector<std::vector<unsigned char> > as an input parameter.
-     *  The receiver object then automatically creates a separate thread that pulls samples
-     *  from the USRP and processes them with the receive chain. The received packets (if any)
-     *  are then passed into the callback function where the user is able to process them further.
+     *  function that takes a std::vector<rx_packet> & as an input parameter. Each rx_packet
+     *  holds a payload and the absolute sample index and device time of the frame's STS.
+     *  The vector and the payload buffers are recycled: the callback may move the packets it
+     *  wants to keep out of the vector, the payloads of the others go back to the receiver's
+     *  pool once it returns, so no packet is copied or allocated on its way to the callback.
+     *  The receiver object then automatically creates a capture thread that pulls samples
+     *  from the USRP into a capture_ring, and a separate thread that processes them with the
+     *  receive chain. The received packets are then queued in a packet_queue from which
+     *  delivery threads pass them into the callback function where the user is able to
+     *  process them further. The callback is only called with at least one packet, and a
+     *  slow callback never stalls the receive chain unless the BLOCK overload policy is
+     *  used: with the drop policies the packets it cannot keep up with are dropped and
+     *  counted, see #delivery_statistics().
+     *
+     *  The capture thread runs at real-time priority when it is allowed to and never waits
+     *  for the processing thread, so the USRP keeps being drained while the chain or the
+     *  callback are slow. If the processing thread falls behind by more than the ring holds
+     *  the newest chunks are dropped, see #capture_statistics().
      *
      *  If at any time the user wishes to pause the receiver (i.e. so that the user can transmit
      *  some packets) the user simply needs to call the receiver::pause() function on the receiver
@@ -55,12 +95,13 @@ namespace wno
          *    + tx_gain -> 20 even though it is irrelevant for the receiver
          *    + amp -> 1.0 even though it is irrelevant for the receiver
          */
-        receiver(void(*callback)(std::vector<std::vector<unsigned char> > packets), double freq = 5.72e9, double samp_rate = 5e6, double rx_gain = 20, std::string device_addr = "");
+        receiver(void(*callback)(std::vector<rx_packet> & packets), double freq = 5.72e9, double samp_rate = 5e6, double rx_gain = 20, std::string device_addr = "");
 
         /*!
          * \brief Constructor for the receiver that uses the usrp_params struct
          * \param callback Function pointer to the callback function where received packets are passed
          * \param params [Optional] The usrp parameters you want to use for this receiver.
+         * \param delivery [Optional] How the packets are delivered to the callback.
          *
          *  Defaults to:
          *  - center freq -> 5.72e9 (5.72 GHz)
@@ -69,34 +110,93 @@ namespace wno
          *  - rx gain -> 20 (although this is irrelevant for the transmitter)
          *  - device ip address -> "" (empty string will default to letting the UHD api
          *    automatically find an available USRP)
+         *  - one delivery thread, 256 queued packets, DROP_OLDEST
          */
-        receiver(void(*callback)(std::vector<std::vector<unsigned char> > packets), usrp_params params = usrp_params());
+        receiver(void(*callback)(std::vector<rx_packet> & packets), usrp_params params = usrp_params(),
+                 delivery_params delivery = delivery_params());
 
         /*!
-         * \brief Pauses the receiver thread.
+         * \brief Pauses the capture thread. The samples already captured are still processed.
          */
         void pause();
 
         /*!
-         * \brief Resumes the receiver thread after it has been paused.
+         * \brief Resumes the capture thread after it has been paused.
          */
         void resume();
 
+        /*!
+         * \brief Gets the statistics of the capture ring: the chunks captured and dropped
+         *  (ring overflows), the overflows the USRP reported and the high-water mark of the
+         *  chunks waiting to be processed.
+         */
+        capture_stats capture_statistics() { return m_capture_ring.stats(); }
+
+        /*!
+         * \brief Starts the high-water mark of the capture ring over from zero.
+         */
+        void reset_capture_high_water() { m_capture_ring.reset_high_water(); }
+
+        /*!
+         * \brief Gets the counters of the packet delivery: the packets queued, delivered to
+         *  the callback and dropped by the overload policy.
+         */
+        delivery_stats delivery_statistics() { return m_packet_queue.stats(); }
+
+        /*!
+         * \brief Gets the number of bytes allocated for the samples in flight: the capture ring
+         *  and the buffers of the receiver chain, which is sized for #NUM_RX_SAMPLES per chunk.
+         */
+        size_t buffer_footprint();
+
+        /*!
+         * \brief Sets a callback function that the receiver thread passes every detected
+         *  underlay bit to after each chunk of samples. Pass NULL to go back to polling.
+         * \param callback Function pointer to the callback function where underlay events are passed
+         */
+        void set_underlay_callback(void(*callback)(underlay_event event)) { m_underlay_callback = callback; }
+
+        /*!
+         * \brief Gets the next detected underlay bit. Only valid while no underlay callback is set
+         *  and only one thread may poll.
+         * \param event Set to the oldest event not polled yet.
+         * \return False if there was no event.
+         */
+        bool poll_underlay_event(underlay_event & event) { return m_rec_chain.poll_underlay_event(event); }
+
     private:
 
-        void receiver_chain_loop(); //!< Infinite while loop where samples are received from USRP and processed by the receiver_chain
+        void capture_loop(); //!< Infinite while loop where samples are received from the USRP into the capture ring
+
+        void receiver_chain_loop(); //!< Infinite while loop where the captured samples are processed by the receiver_chain
 
-        void (*m_callback)(std::vector<std::vector<unsigned char> > packets); //!< Callback function pointer
+        void delivery_loop(); //!< Infinite while loop where the queued packets are passed to the callback
+
+        void (*m_callback)(std::vector<rx_packet> & packets); //!< Callback function pointer
+
+        std::atomic<void (*)(underlay_event event)> m_underlay_callback; //!< Underlay event callback function pointer (NULL to poll instead)
 
         usrp m_usrp; //!< The usrp object used to receiver frames over the air
 
         receiver_chain m_rec_chain; //!< The receiver chain object used to detect & decode incoming frames
 
-        std::vector<std::complex<double> > m_samples; //!< Vector to hold the raw samples received from the USRP and passed into the receiver_chain
+        capture_ring m_capture_ring; //!< Ring of raw sample chunks from the capture thread to the receiver thread
+
+        packet_queue m_packet_queue; //!< Packets waiting to be passed to the callback
+
+        std::vector<std::complex<double> > m_samples; //!< Vector to hold the raw samples taken from the capture ring and passed into the receiver_chain
+
+        std::vector<rx_packet> m_packets; //!< The packets of the chunk being processed, recycled from chunk to chunk
+
+        double m_sample_rate; //!< Sample rate of the USRP, times the samples within a chunk
+
+        std::thread m_capture_thread; //!< The thread that pulls the samples from the USRP
 
         std::thread m_rec_thread; //!< The thread that the receiver chain runs in
 
-        sem_t m_pause; //!< Semaphore used to pause the receiver thread
+        std::vector<std::thread> m_delivery_threads; //!< The threads calling the callback
+
+        sem_t m_pause; //!< Semaphore used to pause the capture thread
 
 
 
@@ -8,6 +8,7 @@
  */
 
 #include <iostream>
+#include <algorithm>
 #include <functional>
 #include <boost/date_time/posix_time/posix_time.hpp>
 
@@ -17,6 +18,8 @@ namespace wno
 {
     /*!
      * -Initializes each receiver chain block:
+     *  + underlay_decode
+     *  + underlay_canceller (if enabled)
      *  + frame_detector
      *  + timing_sync
      *  + fft_symbols
@@ -24,32 +27,202 @@ namespace wno
      *  + phase_tracker
      *  + frame_decoder
      *
-     *  Adds each block to the receiver chain.
+     *  Each block is sized for the items the block before it outputs from a chunk of
+     *  max_chunk samples.
+     *
+     *  Adds each block to the receiver chain. The underlay_decode block is added
+     *  as a tap on the input of the first block, i.e. the underlay_canceller if
+     *  enabled or the frame_detector otherwise.
+     *
+     *  In the other schedules the blocks are connected by rings instead, see
+     *  #build_pipeline().
      */
-    receiver_chain::receiver_chain()
-    {
-        m_ul_decoder = new underlay_decode();
-        m_frame_detector = new frame_detector();
-        m_timing_sync = new timing_sync();
-        m_fft_symbols = new fft_symbols();
-        m_channel_est = new channel_est();
-        m_phase_tracker = new phase_tracker();
-        m_frame_decoder = new frame_decoder();
-
-        // We use semaphore references, so we don't
-        // want them to move to a different memory location
-        // if the vectors get resized
-        m_wake_sems.reserve(100);
-        m_done_sems.reserve(100);
+    receiver_chain::receiver_chain(chain_params params) :
+        m_params(params),
+        m_ul_canceller(NULL),
+        m_taps_running(false),
+        m_input_ring(NULL),
+        m_tap_ring(NULL),
+        m_output_ring(NULL),
+        m_tap_stage(NULL),
+        m_output_stage(NULL),
+        m_pool(NULL)
+    {
+        // The decoder borrows the pool's workers instead of starting its own
+        m_ul_decoder = new underlay_decode((params.schedule == WORK_STEALING) ? 0 : 2, false, DEFAULT_PN_LENGTH, params.max_chunk);
+        if(params.cancel_underlay) m_ul_canceller = new underlay_canceller(m_ul_decoder->codes(), params.max_chunk);
+        m_frame_detector = new frame_detector(params.max_chunk);
+        m_timing_sync = new timing_sync(m_frame_detector->max_output);
+        m_fft_symbols = new fft_symbols(m_timing_sync->max_output);
+        m_channel_est = new channel_est(m_fft_symbols->max_output);
+        m_phase_tracker = new phase_tracker(m_channel_est->max_output);
+        m_frame_decoder = new frame_decoder((params.schedule == WORK_STEALING) ? 0 : params.decode_workers, m_phase_tracker->max_output);
+
+        if(params.schedule != LOCK_STEP)
+        {
+            build_pipeline();
+            return;
+        }
 
         // Add the blocks to the receiver chain
-        add_block(m_ul_decoder);
+        if(m_ul_canceller) add_block(m_ul_canceller);
         add_block(m_frame_detector);
         add_block(m_timing_sync);
         add_block(m_fft_symbols);
         add_block(m_channel_est);
         add_block(m_phase_tracker);
         add_block(m_frame_decoder);
+
+        // The underlay detector reads the raw samples alongside the first block
+        if(m_ul_canceller)
+        {
+            m_ul_decoder->connect(m_ul_canceller->input_buffer);
+            m_ul_decoder->set_canceller(m_ul_canceller);
+        }
+        else
+        {
+            m_ul_decoder->connect(m_frame_detector->input_buffer);
+        }
+        add_tap(m_ul_decoder);
+    }
+
+    receiver_chain::receiver_chain(bool cancel_underlay) :
+        receiver_chain(chain_params(cancel_underlay))
+    {
+    }
+
+    /*!
+     * Each block gets a ring for its input chunks. If the underlay_decode block only taps the
+     * samples, the frame_detector stage passes each chunk on to it once it is done with it, so
+     * the decoder reads the chunk itself right behind the detector and the chunk is recycled
+     * once both have read it. The tap stage comes last so that every stage comes after the one
+     * feeding it. When cancellation is enabled the decoder is put in front of the
+     * underlay_canceller instead and passes each chunk on once it has posted the chunk's
+     * decisions.
+     *
+     * Only chunks with items are pushed, so at most one payload chunk per chunk in flight
+     * reaches #m_output_ring. It is sized for all of them so that the frame_decoder never
+     * waits for #process_samples() to collect its output (which could deadlock with
+     * #process_samples() waiting for room in #m_input_ring).
+     */
+    void receiver_chain::build_pipeline()
+    {
+        int depth = m_params.ring_depth;
+        m_input_ring = new chunk_ring<std::complex<double> >(depth, m_params.wait, m_params.spin_count);
+        chunk_ring<std::complex<double> > * detector_ring = m_input_ring;
+        if(m_ul_canceller)
+        {
+            chunk_ring<std::complex<double> > * canceller_ring = new chunk_ring<std::complex<double> >(depth, m_params.wait, m_params.spin_count);
+            detector_ring = new chunk_ring<std::complex<double> >(depth, m_params.wait, m_params.spin_count);
+            m_ul_decoder->set_canceller(m_ul_canceller);
+            m_stages.push_back(new tap_stage<std::complex<double> >(m_ul_decoder, m_input_ring, canceller_ring));
+            m_stages.push_back(new block_stage<std::complex<double>, std::complex<double> >(m_ul_canceller, canceller_ring, detector_ring));
+        }
+        else
+        {
+            m_tap_ring = new chunk_ring<std::complex<double> >(depth, m_params.wait, m_params.spin_count);
+        }
+
+        chunk_ring<std::complex<double> > * sync_ring = new chunk_ring<std::complex<double> >(depth, m_params.wait, m_params.spin_count);
+        chunk_ring<std::complex<double> > * fft_ring = new chunk_ring<std::complex<double> >(depth, m_params.wait, m_params.spin_count);
+        chunk_ring<tagged_vector<64> > * chan_ring = new chunk_ring<tagged_vector<64> >(depth, m_params.wait, m_params.spin_count);
+        chunk_ring<tagged_vector<64> > * phase_ring = new chunk_ring<tagged_vector<64> >(depth, m_params.wait, m_params.spin_count);
+        chunk_ring<tagged_vector<48> > * decoder_ring = new chunk_ring<tagged_vector<48> >(depth, m_params.wait, m_params.spin_count);
+        block_stage<std::complex<double>, std::complex<double> > * detector_stage =
+            new block_stage<std::complex<double>, std::complex<double> >(m_frame_detector, detector_ring, sync_ring);
+        m_stages.push_back(detector_stage);
+        m_stages.push_back(new block_stage<std::complex<double>, std::complex<double> >(m_timing_sync, sync_ring, fft_ring));
+        m_stages.push_back(new block_stage<std::complex<double>, tagged_vector<64> >(m_fft_symbols, fft_ring, chan_ring));
+        m_stages.push_back(new block_stage<tagged_vector<64>, tagged_vector<64> >(m_channel_est, chan_ring, phase_ring));
+        m_stages.push_back(new block_stage<tagged_vector<64>, tagged_vector<48> >(m_phase_tracker, phase_ring, decoder_ring));
+
+        m_output_ring = new chunk_ring<rx_packet>((m_stages.size() + 1) * (depth + 1) + 1, m_params.wait, m_params.spin_count);
+        m_output_stage = new block_stage<tagged_vector<48>, rx_packet>(m_frame_decoder, decoder_ring, m_output_ring);
+        m_stages.push_back(m_output_stage);
+
+        // Every stage feeds the next one
+        for(int x = 0; x + 1 < m_stages.size(); x++)
+        {
+            m_stages[x]->downstream = m_stages[x + 1];
+            m_stages[x + 1]->upstream = m_stages[x];
+        }
+
+        // A decoder that only taps the samples reads the chunks the frame_detector passes on
+        if(m_tap_ring)
+        {
+            detector_stage->pass_input(m_tap_ring);
+            m_tap_stage = new tap_stage<std::complex<double> >(m_ul_decoder, m_tap_ring);
+            m_tap_stage->upstream = detector_stage;
+            detector_stage->input_reader = m_tap_stage;
+            m_stages.push_back(m_tap_stage);
+        }
+
+        if(m_params.schedule == WORK_STEALING)
+        {
+            m_pool = m_params.pool;
+            if(!m_pool)
+            {
+                int num_workers = m_params.num_workers;
+                if(num_workers <= 0) num_workers = std::max(1u, std::thread::hardware_concurrency());
+                m_pool = new work_stealing_pool(num_workers);
+            }
+            m_ul_decoder->set_pool(m_pool);
+            m_frame_decoder->set_pool(m_pool);
+            return;
+        }
+
+        // Only a decoder that taps the samples runs alongside the depth-first pass
+        if(m_params.schedule == DEPTH_FIRST)
+        {
+            if(m_tap_stage) m_threads.push_back(std::thread(run_stage, m_tap_stage));
+            return;
+        }
+
+        for(int x = 0; x < m_stages.size(); x++)
+        {
+            m_threads.push_back(std::thread(run_stage, m_stages[x]));
+        }
+    }
+
+    void receiver_chain::schedule(stage_base * stage)
+    {
+        if(stage && !stage->scheduled.exchange(true))
+        {
+            m_pool->submit(std::bind(&receiver_chain::run_stage_task, this, stage));
+        }
+    }
+
+    /*!
+     * Runs the stage on every chunk waiting in its input ring. A worker never waits for
+     * room in the output ring, the output is kept in the block instead (the stage stays
+     * busy) and pushed the next time the stage runs, which happens once the downstream
+     * stage has pulled a chunk. Pulling a chunk in turn schedules the upstream stage in case
+     * it was holding back an output.
+     *
+     * After clearing its scheduled flag the stage checks once more whether it can make
+     * progress, in case a neighbour tried to schedule it while the flag was still set.
+     */
+    void receiver_chain::run_stage_task(stage_base * stage)
+    {
+        while(1)
+        {
+            if(stage->busy())
+            {
+                if(!stage->push()) break;
+                schedule(stage->downstream);
+                schedule(stage->input_reader);
+            }
+            if(!stage->pull()) break;
+            schedule(stage->upstream);
+            stage->work();
+            if(!stage->push()) break;
+            schedule(stage->downstream);
+            schedule(stage->input_reader);
+        }
+
+        stage->scheduled = false;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(stage->busy() ? !stage->output_full() : !stage->input_empty()) schedule(stage);
     }
 
     /*!
@@ -59,14 +232,19 @@ namespace wno
      */
     void receiver_chain::add_block(wno::block_base * block)
     {
-        m_wake_sems.push_back(sem_t());
-        m_done_sems.push_back(sem_t());
+        m_wake_sems.push_back(new handoff(m_params.wait, m_params.spin_count));
+        m_done_sems.push_back(new handoff(m_params.wait, m_params.spin_count));
         int index = m_wake_sems.size() - 1;
-        sem_init(&m_wake_sems[index], 0, 0);
-        sem_init(&m_done_sems[index], 0, 0);
+        m_is_tap.push_back(false);
         m_threads.push_back(std::thread(&receiver_chain::run_block, this, index, block));
     }
 
+    void receiver_chain::add_tap(wno::block_base * tap)
+    {
+        add_block(tap);
+        m_is_tap.back() = true;
+    }
+
     /*!
      * The #run_block function is the main thread for controlling the calls to
      * each block's work function. This function is a forever loops that first waits
@@ -81,9 +259,10 @@ namespace wno
     {
         while(1)
         {
-            sem_wait(&m_wake_sems[index]);
+            m_wake_sems[index]->wait();
 
             boost::posix_time::ptime start = boost::posix_time::microsec_clock::local_time();
+            block->prepare();
             block->work();
             boost::posix_time::time_duration elapsed = boost::posix_time::microsec_clock::local_time() - start;
 
@@ -92,10 +271,36 @@ namespace wno
                 //std::cout << "! - " <<  block->name << std::endl;
             }
 
-            sem_post(&m_done_sems[index]);
+            m_done_sems[index]->post();
         }
     }
 
+    std::vector<rx_packet> receiver_chain::process_samples(std::vector<std::complex<double> > samples)
+    {
+        std::vector<stream_tag> tags;
+        std::vector<rx_packet> packets;
+        process_chunk(samples, tags, packets);
+        return packets;
+    }
+
+    std::vector<rx_packet> receiver_chain::process_samples(std::vector<std::complex<double> > samples, const sample_stamp & stamp, double sample_rate)
+    {
+        std::vector<rx_packet> packets;
+        process_samples(samples, stamp, sample_rate, packets);
+        return packets;
+    }
+
+    /*!
+     * The stamp goes along with the samples as a #CHUNK_START tag on the first one. The tags
+     * are swapped into the chain like the samples, so #m_chunk_tags always gets recycled
+     * storage back.
+     */
+    void receiver_chain::process_samples(std::vector<std::complex<double> > & samples, const sample_stamp & stamp, double sample_rate, std::vector<rx_packet> & packets)
+    {
+        m_chunk_tags.assign(1, stream_tag(0, CHUNK_START, sample_rate, stamp));
+        process_chunk(samples, m_chunk_tags, packets);
+    }
+
     /*!
      * This function is the main scheduler for the receive chain. It takes in raw complex samples
      * from the usrp block and passes them first into the Frame Detector block's input buffer.
@@ -104,29 +309,185 @@ namespace wno
      * Once all the threads are done it shifts the contents of each blocks output buffer to the input
      * buffer of the next block in the chain and returns the contents of the Frame Decoder's
      * output buffer.
+     *
+     * When underlay cancellation is enabled the samples go through the Underlay Canceller
+     * block first.
+     *
+     * The taps are not waited on before returning. Since they read the first block's input
+     * buffer they are waited on at the start of the next call instead, right before that buffer
+     * is overwritten with the new samples.
+     *
+     * In the PIPELINED schedule the samples are pushed into the input ring and the payloads
+     * the frame_decoder delivered so far are returned. In the DEPTH_FIRST schedule the stages
+     * are then run on the samples before returning, except for an underlay_decode block that
+     * only taps them, which reads them on its own thread once the frame_detector is done.
+     *
+     * The tags go along with the samples to the first block.
+     *
+     * The pieces of a split input are assigned into a member. Pushing them hands back a
+     * recycled chunk, so it keeps its storage.
      */
-    std::vector<std::vector<unsigned char> > receiver_chain::process_samples(std::vector<std::complex<double> > samples)
+    void receiver_chain::process_chunk(std::vector<std::complex<double> > & samples, std::vector<stream_tag> & tags, std::vector<rx_packet> & packets)
     {
-        // samples -> sync short in
-        // m_frame_detector->input_buffer.swap(samples);
-        m_ul_decoder->input_buffer.swap(samples);
+        // The blocks' buffers only have room for the items of max_chunk samples
+        if(samples.size() > m_params.max_chunk)
+        {
+            int t = 0;
+            for(size_t x = 0; x < samples.size(); x += m_params.max_chunk)
+            {
+                size_t end = std::min(x + m_params.max_chunk, samples.size());
+                m_split_chunk.assign(samples.begin() + x, samples.begin() + end);
+                m_split_tags.resize(0);
+                for(; t < tags.size() && tags[t].offset < end; t++)
+                {
+                    m_split_tags.push_back(tags[t]);
+                    m_split_tags.back().offset -= x;
+                }
+                process_chunk(m_split_chunk, m_split_tags, packets);
+            }
+            return;
+        }
+
+        if(m_params.schedule != LOCK_STEP)
+        {
+            if(samples.size())
+            {
+                while(!m_input_ring->push(samples, tags)) m_input_ring->wait_space();
+                if(m_pool) schedule(m_stages[0]);
+                if(m_params.schedule == DEPTH_FIRST) run_depth_first(m_stages, m_tap_stage);
+            }
+            collect(packets);
+            return;
+        }
+
+        // The taps may still be reading the previous samples
+        if(m_taps_running)
+        {
+            for(int x = 0; x < m_done_sems.size(); x++) if(m_is_tap[x]) m_done_sems[x]->wait();
+        }
+
+        // samples -> sync short in (or underlay canceller in)
+        if(m_ul_canceller)
+        {
+            m_ul_canceller->input_buffer.swap(samples);
+            m_ul_canceller->input_tags.swap(tags);
+        }
+        else
+        {
+            m_frame_detector->input_buffer.swap(samples);
+            m_frame_detector->input_tags.swap(tags);
+        }
 
         // Unlock the threads
-        for(int x = 0; x < m_wake_sems.size(); x++) sem_post(&m_wake_sems[x]);
+        for(int x = 0; x < m_wake_sems.size(); x++) m_wake_sems[x]->post();
+        m_taps_running = true;
 
-        // Wait for the threads to finish
-        for(int x = 0; x < m_done_sems.size(); x++) sem_wait(&m_done_sems[x]);
+        // Wait for the blocks to finish
+        for(int x = 0; x < m_done_sems.size(); x++) if(!m_is_tap[x]) m_done_sems[x]->wait();
 
         // Update the buffers
-        m_frame_detector->input_buffer.swap(m_ul_decoder->output_buffer);
+        if(m_ul_canceller)
+        {
+            m_frame_detector->input_buffer.swap(m_ul_canceller->output_buffer);
+            m_frame_detector->input_tags.swap(m_ul_canceller->output_tags);
+        }
         m_timing_sync->input_buffer.swap(m_frame_detector->output_buffer);
+        m_timing_sync->input_tags.swap(m_frame_detector->output_tags);
         m_fft_symbols->input_buffer.swap(m_timing_sync->output_buffer);
+        m_fft_symbols->input_tags.swap(m_timing_sync->output_tags);
         m_channel_est->input_buffer.swap(m_fft_symbols->output_buffer);
         m_phase_tracker->input_buffer.swap(m_channel_est->output_buffer);
         m_frame_decoder->input_buffer.swap(m_phase_tracker->output_buffer);
 
         // Return any completed packets
-        return m_frame_decoder->output_buffer;
+        for(int x = 0; x < m_frame_decoder->output_buffer.size(); x++) packets.push_back(std::move(m_frame_decoder->output_buffer[x]));
+    }
+
+    bool receiver_chain::lock_step_pending()
+    {
+        if(m_ul_canceller && m_frame_detector->input_buffer.size()) return true;
+        return m_timing_sync->input_buffer.size() || m_fft_symbols->input_buffer.size() || m_channel_est->input_buffer.size()
+                || m_phase_tracker->input_buffer.size() || m_frame_decoder->input_buffer.size();
+    }
+
+    /*!
+     * The sizes are the ones the blocks declared, so the footprint does not depend on what
+     * the chain received so far. The payloads are not counted.
+     */
+    size_t receiver_chain::buffer_footprint()
+    {
+        size_t bytes = m_ul_decoder->buffer_footprint();
+        if(m_ul_canceller) bytes += m_ul_canceller->buffer_footprint();
+        bytes += m_frame_detector->buffer_footprint();
+        bytes += m_timing_sync->buffer_footprint();
+        bytes += m_fft_symbols->buffer_footprint();
+        bytes += m_channel_est->buffer_footprint();
+        bytes += m_phase_tracker->buffer_footprint();
+        bytes += m_frame_decoder->buffer_footprint();
+        for(int x = 0; x < m_stages.size(); x++) bytes += m_stages[x]->buffer_footprint();
+        return bytes;
+    }
+
+    /*!
+     * The popped chunks are swapped with #m_collected so that the ring gets storage back
+     * that the frame_decoder can fill without allocating.
+     */
+    void receiver_chain::collect(std::vector<rx_packet> & packets)
+    {
+        while(m_output_ring->pop(m_collected))
+        {
+            for(int x = 0; x < m_collected.size(); x++) packets.push_back(std::move(m_collected[x]));
+        }
+
+        // The frame_decoder may be holding back an output for lack of room
+        if(m_pool && m_output_stage->busy()) schedule(m_output_stage);
+    }
+
+    /*!
+     * In the LOCK_STEP schedule the chain is run on empty inputs until the outputs of the
+     * last call have gone through every block, i.e. until no block after the first one has
+     * input left. A block without input clears its output, so nothing is run twice.
+     *
+     * In the other schedules the stages are flushed like those of a block_graph, see
+     * flush_stages(). The frame_decoder stage's finish() waits for the frames still being
+     * decoded and pushes their payloads to #m_output_ring.
+     *
+     * In the LOCK_STEP schedule the frames still being decoded are waited for once the
+     * blocks are idle.
+     */
+    std::vector<rx_packet> receiver_chain::flush()
+    {
+        std::vector<rx_packet> packets;
+        if(m_params.schedule == LOCK_STEP)
+        {
+            std::vector<std::complex<double> > samples;
+            std::vector<stream_tag> tags;
+            while(lock_step_pending())
+            {
+                samples.resize(0);
+                tags.resize(0);
+                process_chunk(samples, tags, packets);
+            }
+
+            if(m_taps_running)
+            {
+                for(int x = 0; x < m_done_sems.size(); x++) if(m_is_tap[x]) m_done_sems[x]->wait();
+                m_taps_running = false;
+            }
+            m_frame_decoder->drain(packets);
+            return packets;
+        }
+
+        flush_stages(m_stages, [&]() { collect(packets); }, [&](stage_base * stage)
+        {
+            if(m_params.schedule == DEPTH_FIRST) run_depth_first(m_stages, m_tap_stage);
+            else if(m_pool)
+            {
+                schedule(stage->downstream);
+                schedule(stage->input_reader);
+            }
+        });
+        return packets;
     }
 
 }
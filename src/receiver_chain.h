@@ -11,32 +11,111 @@
 #define RECEIVER_CHAIN_H
 
 #include <thread>
-#include <semaphore.h>
 
 #include "fft_symbols.h"
 #include "channel_est.h"
 #include "phase_tracker.h"
 #include "frame_decoder.h"
+#include "rx_packet.h"
 #include "block.h"
 #include "tagged_vector.h"
 #include "frame_detector.h"
 #include "timing_sync.h"
 #include "underlay_decode.h"
+#include "underlay_canceller.h"
+#include "handoff.h"
+#include "chunk_ring.h"
+#include "stage.h"
+#include "work_stealing_pool.h"
 
 namespace wno
 {
+    /*!
+     * \brief Parameters of a receiver chain.
+     */
+    struct chain_params
+    {
+        bool cancel_underlay;       //!< Subtract the detected underlay before the frame_detector
+        chain_schedule schedule;    //!< How the blocks are scheduled
+        int ring_depth;             //!< Number of chunks each ring between two blocks can hold (all but LOCK_STEP)
+        int num_workers;            //!< Number of workers of the chain's own pool, 0 for one per core (WORK_STEALING only)
+        work_stealing_pool * pool;  //!< Pool shared with other chains or NULL for a pool of the chain's own (WORK_STEALING only)
+        wait_strategy wait;         //!< How the block threads wait for their input and for room in their output (not WORK_STEALING, a polling chain must live for the whole process)
+        int spin_count;             //!< Number of polls before a WAIT_SPIN_THEN_BLOCK wait blocks
+        int decode_workers;         //!< Number of frame decoding threads of the frame_decoder, 0 to decode in its own thread (not WORK_STEALING)
+        size_t max_chunk;           //!< Most samples per chunk the blocks' buffers are sized for (larger inputs are split)
+
+        /*!
+         * \brief Constructor for chain_params. Simply initializes member fields to be looked up later.
+         * \param cancel_underlay -> #cancel_underlay
+         * \param schedule -> #schedule
+         * \param ring_depth -> #ring_depth
+         * \param num_workers -> #num_workers
+         * \param pool -> #pool
+         * \param wait -> #wait
+         * \param spin_count -> #spin_count
+         * \param decode_workers -> #decode_workers
+         * \param max_chunk -> #max_chunk
+         */
+        chain_params(bool cancel_underlay = false, chain_schedule schedule = LOCK_STEP, int ring_depth = 4, int num_workers = 0,
+                     work_stealing_pool * pool = NULL, wait_strategy wait = WAIT_BLOCK, int spin_count = DEFAULT_SPIN_COUNT,
+                     int decode_workers = DEFAULT_DECODE_WORKERS, size_t max_chunk = BUFFER_MAX) :
+            cancel_underlay(cancel_underlay),
+            schedule(schedule),
+            ring_depth(ring_depth),
+            num_workers(num_workers),
+            pool(pool),
+            wait(wait),
+            spin_count(spin_count),
+            decode_workers(decode_workers),
+            max_chunk(max_chunk)
+        {
+        }
+    };
+
 
     /*! \brief The Receiver Chain class.
      *
      *  Inputs raw complex doubles representing the base-band digitized time domain signal.
      *
-     *  Outputs vector of correctly received payloads (MPDUs) which are themselves vectors
-     *  of unsigned chars.
+     *  Outputs vector of correctly received packets, each holding the payload (MPDU) and the
+     *  stamp of the frame's STS.
      *
      *  The Receiver Chain class is the main controller for the blocks that are
      *  used to receive and decode PHY layer frames. It holds the instances of each block
      *  and shifts the data through the receive chain as it is processed eventually returning
      *  the correctly received payloads (MPDUs) which can then be passed to the upper layers.
+     *
+     *  In the LOCK_STEP schedule each call to #process_samples() runs every block once and
+     *  then moves each block's output to the next block, so every block adds one call of
+     *  latency and the slowest block gates the whole chain.
+     *
+     *  In the PIPELINED schedule the blocks are connected by lock-free chunk_rings and each
+     *  block thread runs whenever a chunk is waiting in its input ring, so the throughput is
+     *  only bounded by the slowest block. #process_samples() pushes the samples into the
+     *  first ring (waiting only if it is full) and returns the packets that came out of
+     *  the chain since the previous call. When underlay cancellation is enabled the chunks
+     *  go through the underlay_decode block before the underlay_canceller so that the
+     *  canceller always runs behind the decoder.
+     *
+     *  The WORK_STEALING schedule uses the same rings but instead of a thread per block,
+     *  a block is queued on a work_stealing_pool whenever a chunk arrives in its input ring.
+     *  Several chains can share one pool sized to the available cores, and the
+     *  underlay_decode block splits its acquisition search over the idle workers of the pool
+     *  and the frame_decoder decodes its frames on it.
+     *
+     *  The DEPTH_FIRST schedule trades throughput for latency: #process_samples() runs the
+     *  chunk through every block in turn on the caller's thread, so a packet is returned by
+     *  the same call that delivered its last sample. Only the underlay_decode block keeps a
+     *  thread of its own when it merely taps the samples, since the packets do not depend on it.
+     *
+     *  Each block sizes its buffers for the items it gets from a chunk of chain_params::max_chunk
+     *  samples, so the chain should be built for the chunk size it is actually fed.
+     *
+     *  A chain is not meant to be destroyed once it has been built: its block threads (or the
+     *  tasks queued on its pool) are never stopped, so it should live for the whole process.
+     *  This matters most with WAIT_SPIN_THEN_BLOCK or WAIT_BUSY_POLL waits, where every block
+     *  of a dropped chain would keep a core busy; build the chains once and reuse them.
      */
     class receiver_chain
     {
@@ -44,17 +123,72 @@ namespace wno
 
         /*!
          * \brief Constructor for receiver_chain
+         * \param cancel_underlay Subtract the detected underlay from the samples before they
+         *  reach the frame_detector. This delays the overlay path by about one chunk plus one
+         *  PN period.
          */
-        receiver_chain();
+        receiver_chain(bool cancel_underlay = false);
+
+        /*!
+         * \brief Constructor for receiver_chain
+         * \param params The parameters of the chain.
+         */
+        receiver_chain(chain_params params);
 
         /*!
          * \brief Processes the raw time domain samples.
          * \param samples A vector of received time-domain samples from the usrp block to pass to
-         *  the receive chain for signal processing.
-         * \return A vector of correctly received payloads where each payload is its own vector
-         *  of unsigned chars.
+         *  the receive chain for signal processing. More than chain_params::max_chunk samples
+         *  are passed on in several chunks.
+         * \return A vector of correctly received packets. Their stamps count the samples from
+         *  the first one passed to the chain, or from the last stamp passed to the other overload.
+         */
+        std::vector<rx_packet> process_samples(std::vector<std::complex<double> > samples);
+
+        /*!
+         * \brief Processes the raw time domain samples of a stamped chunk.
+         * \param samples A vector of received time-domain samples, as above.
+         * \param stamp Absolute index and device time of the first sample. The index should
+         *  skip the samples of any chunks dropped since the last call.
+         * \param sample_rate Sample rate in samples per second, used to time the later samples.
+         * \return A vector of correctly received packets, stamped with the index and time of
+         *  the #STS_START of their frame.
+         */
+        std::vector<rx_packet> process_samples(std::vector<std::complex<double> > samples, const sample_stamp & stamp, double sample_rate);
+
+        /*!
+         * \brief Same as the stamped #process_samples() above without copying or allocating
+         *  anything once the chain's buffers have grown to the chunks.
+         * \param samples The samples, swapped into the chain. Left holding a recycled buffer of
+         *  the chain that can be filled with the next chunk.
+         * \param stamp Absolute index and device time of the first sample.
+         * \param sample_rate Sample rate in samples per second.
+         * \param packets The correctly received packets are moved to the end of this.
+         */
+        void process_samples(std::vector<std::complex<double> > & samples, const sample_stamp & stamp, double sample_rate, std::vector<rx_packet> & packets);
+
+        /*!
+         * \brief Gets the next underlay bit detected by the underlay_decode block. The decoder
+         *  runs alongside the chain, so the events of a chunk may only become available during
+         *  the following calls to #process_samples(). Only one thread may poll the events.
+         * \param event Set to the oldest event not polled yet.
+         * \return False if there was no event.
+         */
+        bool poll_underlay_event(underlay_event & event) { return m_ul_decoder->poll_event(event); }
+
+        /*!
+         * \brief Waits until the chain has processed every sample passed to #process_samples()
+         *  and the frame_decoder has decoded every frame.
+         * \return The packets received since the last call to #process_samples().
          */
-        std::vector<std::vector<unsigned char> > process_samples(std::vector<std::complex<double> > samples);
+        std::vector<rx_packet> flush();
+
+        /*!
+         * \brief Gets the number of bytes allocated for the chunks going through the chain:
+         *  the buffers of the blocks and, in the ring based schedules, the chunks recycled
+         *  through the rings.
+         */
+        size_t buffer_footprint();
 
     private:
 
@@ -62,7 +196,8 @@ namespace wno
          * Blocks *
          **********/
 
-        underlay_decode * m_ul_decoder;
+        underlay_decode * m_ul_decoder;        //!< Underlay PN detection (tap on the first block's input)
+        underlay_canceller * m_ul_canceller;   //!< Underlay cancellation (NULL unless enabled)
         frame_detector * m_frame_detector;     //!< Detects start of frame using STS
         timing_sync    * m_timing_sync;        //!< Aligns frame in time using LTS & some freq correction
         fft_symbols    * m_fft_symbols;        //!< Forward FFT of symbols
@@ -80,6 +215,16 @@ namespace wno
          */
         void add_block(wno::block_base * block);
 
+        /*!
+         * \brief Adds a tap to the receiver call chain
+         *
+         * A tap is woken up together with the blocks but the chain does not wait for it
+         * before returning. It is only waited on before the buffer it reads is overwritten
+         * by the next call to #process_samples().
+         * \param tap A pointer to the tap so that its work function can be called
+         */
+        void add_tap(wno::block_base * tap);
+
         /*!
          * \brief Runs the block by calling its work function
          * \param index the block's index for referencing the correct semaphores for that block.
@@ -87,14 +232,87 @@ namespace wno
          */
         void run_block(int index, wno::block_base * block);
 
+        /*!
+         * \brief Builds the rings and stages of the ring based schedules and starts their threads.
+         */
+        void build_pipeline();
+
+        /*!
+         * \brief Queues a stage on #m_pool unless it is already queued or running.
+         * \param stage The stage to queue (NULL is ignored).
+         */
+        void schedule(stage_base * stage);
+
+        /*!
+         * \brief Pool task running a stage in the WORK_STEALING schedule.
+         * \param stage The stage to run.
+         */
+        void run_stage_task(stage_base * stage);
+
+        /*!
+         * \brief Runs samples and their tags through the chain.
+         * \param samples The samples, left empty (or holding recycled storage).
+         * \param tags The tags of the samples, sorted by offset.
+         * \param packets The packets that came out of the chain are moved to the end of this.
+         */
+        void process_chunk(std::vector<std::complex<double> > & samples, std::vector<stream_tag> & tags, std::vector<rx_packet> & packets);
+
+        /*!
+         * \brief Whether a block after the first one still has input from the last call to
+         *  #process_samples() in the LOCK_STEP schedule.
+         */
+        bool lock_step_pending();
+
+        /*!
+         * \brief Appends the packets waiting in #m_output_ring to packets.
+         */
+        void collect(std::vector<rx_packet> & packets);
+
+        chain_params m_params; //!< Parameters of the chain
+
 
         std::vector<std::thread> m_threads; //!< Vector of threads - one for each block
 
 
-        std::vector<sem_t> m_wake_sems; //!< Vector of semaphores used to "wake up" each block
+        std::vector<handoff *> m_wake_sems; //!< Vector of semaphores used to "wake up" each block
+
+
+        std::vector<handoff *> m_done_sems; //!< Vector of semaphores used to determine when the blocks are done
+
+
+        std::vector<bool> m_is_tap; //!< Whether each block is a tap which is waited on lazily
+
+
+        bool m_taps_running; //!< Whether the taps were woken up and have not been waited on yet
+
+
+        std::vector<stage_base *> m_stages; //!< Stages of the PIPELINED schedule (upstream first)
+
+
+        chunk_ring<std::complex<double> > * m_input_ring; //!< Ring process_samples() feeds the chain through
+
+
+        chunk_ring<std::complex<double> > * m_tap_ring; //!< Ring the frame_detector stage passes the samples on to the underlay_decode block through (NULL if the decoder is in the chain)
+
+
+        chunk_ring<rx_packet> * m_output_ring; //!< Ring the frame_decoder block delivers the packets through
+
+
+        stage_base * m_tap_stage; //!< Stage of the underlay_decode block reading #m_tap_ring, last in #m_stages (NULL if the decoder is in the chain)
+
+
+        stage_base * m_output_stage; //!< Stage of the frame_decoder block
+
+        std::vector<rx_packet> m_collected; //!< Recycled storage of the chunks popped from #m_output_ring
+
+        std::vector<stream_tag> m_chunk_tags; //!< Recycled storage of the tags of the stamped chunks
+
+        std::vector<std::complex<double> > m_split_chunk; //!< Recycled storage of the pieces of inputs larger than chain_params::max_chunk
+
+        std::vector<stream_tag> m_split_tags; //!< Recycled storage of the tags of the pieces
 
 
-        std::vector<sem_t> m_done_sems; //!< Vector of semaphores used to determine when the blocks are done
+        work_stealing_pool * m_pool; //!< Pool the stages run on (WORK_STEALING only)
     };
 
 }
@@ -0,0 +1,81 @@
+/*! \file rx_packet.h
+ *  \brief Header file for the rx_packet struct.
+ *
+ *  The rx_packet struct is what the receiver hands up for every frame it received
+ *  correctly: the payload together with where the frame was found in the received stream
+ *  and how well it was received. The payload is held in a recycled buffer, so an rx_packet
+ *  can only be moved.
+ */
+
+#ifndef RX_PACKET_H
+#define RX_PACKET_H
+
+#include <vector>
+
+#include "tagged_vector.h"
+#include "rates.h"
+#include "payload_pool.h"
+
+namespace wno
+{
+    /*!
+     * \brief The rx_packet struct
+     *
+     * A correctly received frame. The stamp is the one the frame_detector put on the
+     * #STS_START of the frame, so it locates the frame exactly in the stream of samples
+     * received from the radio, across chunk boundaries and dropped chunks.
+     *
+     * The quality figures are measured by the blocks on the way while they process the
+     * frame anyway (see frame_metrics), nothing is computed over the frame a second time.
+     *
+     * The payload buffer goes back to the frame_decoder's payload_pool when the packet is
+     * destroyed or its payload released, so a consumer keeping packets only holds on to
+     * their buffers, and one that is done with them hands them back without a free.
+     */
+    struct rx_packet
+    {
+        payload_buffer payload;             //!< The payload (MPDU)
+        sample_stamp stamp;                 //!< Absolute sample index and device time of the frame's #STS_START
+        double rssi;                        //!< Mean power of the STS in dB relative to a unit sample
+        double cfo;                         //!< Carrier frequency offset in radians per sample
+        double snr;                         //!< Signal to noise ratio of the LTS pair in dB
+        double evm;                         //!< RMS error of the corrected pilots relative to their unit amplitude
+        Rate rate;                          //!< PHY rate of the frame
+        int length;                         //!< Payload length in bytes from the frame header
+        unsigned int path_metric;           //!< Viterbi path metric of the frame's data (0 if every coded bit agreed)
+
+        rx_packet() : rssi(0), cfo(0), snr(0), evm(0), rate(RATE_1_2_BPSK), length(0), path_metric(0) {} //!< Constructor for an empty rx_packet
+
+        /*!
+         * \brief Gets a copy of the packet with its payload copied into another buffer of the pool.
+         */
+        rx_packet clone() const
+        {
+            rx_packet copy;
+            copy.payload = payload.clone();
+            copy.stamp = stamp;
+            copy.rssi = rssi;
+            copy.cfo = cfo;
+            copy.snr = snr;
+            copy.evm = evm;
+            copy.rate = rate;
+            copy.length = length;
+            copy.path_metric = path_metric;
+            return copy;
+        }
+    };
+
+    /*!
+     * \brief Copies a chunk of packets for a ring added with block_stage::add_output(),
+     *  see copy_chunk().
+     * \param copy Set to a clone of every packet of chunk.
+     * \param chunk The packets.
+     */
+    inline void copy_chunk(std::vector<rx_packet> & copy, const std::vector<rx_packet> & chunk)
+    {
+        copy.clear();
+        for(size_t x = 0; x < chunk.size(); x++) copy.push_back(chunk[x].clone());
+    }
+}
+
+#endif // RX_PACKET_H
@@ -0,0 +1,148 @@
+/*! \file spsc_queue.h
+ *  \brief Lock-free single producer single consumer queue.
+ *
+ *  The spsc_queue class is a bounded ring buffer that lets one thread hand items
+ *  to another thread without locks or semaphores, e.g. a block passing results to
+ *  another block that runs in a different thread.
+ */
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <utility>
+#include <vector>
+#include <stddef.h>
+
+namespace wno
+{
+    /*!
+     * \brief The spsc_queue class template.
+     *
+     * Exactly one thread may call #push() and exactly one (other) thread may call #pop().
+     * The capacity is rounded up to a power of 2. #push() does not block, it returns
+     * false instead when the queue is full.
+     */
+    template<typename T>
+    class spsc_queue
+    {
+    public:
+
+        /*!
+         * \brief Constructor for spsc_queue with default constructed slots, which also suits
+         *  items that can only be moved.
+         * \param capacity Minimum number of items the queue can hold.
+         */
+        spsc_queue(size_t capacity) :
+            m_head(0),
+            m_tail(0)
+        {
+            size_t size = 1;
+            while(size < capacity) size <<= 1;
+            m_items.resize(size);
+            m_mask = size - 1;
+        }
+
+        /*!
+         * \brief Constructor for spsc_queue
+         * \param capacity Minimum number of items the queue can hold.
+         * \param item Every slot starts out as a copy of this, e.g. to preallocate the storage
+         *  of the items recycled by #push_swap() and #pop_swap().
+         */
+        spsc_queue(size_t capacity, const T & item) :
+            m_head(0),
+            m_tail(0)
+        {
+            size_t size = 1;
+            while(size < capacity) size <<= 1;
+            m_items.resize(size, item);
+            m_mask = size - 1;
+        }
+
+        /*!
+         * \brief Adds an item to the back of the queue. Producer thread only.
+         * \param item The item to add.
+         * \return False if the queue was full and the item was dropped.
+         */
+        bool push(const T & item)
+        {
+            size_t tail = m_tail.load(std::memory_order_relaxed);
+            if(tail - m_head.load(std::memory_order_acquire) > m_mask) return false;
+            m_items[tail & m_mask] = item;
+            m_tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /*!
+         * \brief Removes the item at the front of the queue. Consumer thread only.
+         * \param item Set to the removed item.
+         * \return False if the queue was empty.
+         */
+        bool pop(T & item)
+        {
+            size_t head = m_head.load(std::memory_order_relaxed);
+            if(head == m_tail.load(std::memory_order_acquire)) return false;
+            item = m_items[head & m_mask];
+            m_head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /*!
+         * \brief Adds an item to the back of the queue by swapping it with the free slot.
+         *  Producer thread only.
+         *
+         * The item receives the previous content of the slot, i.e. an item popped earlier with
+         * #pop_swap(). For containers this recycles their storage instead of copying it.
+         * \param item The item to add.
+         * \return False if the queue was full and the item was left untouched.
+         */
+        bool push_swap(T & item)
+        {
+            size_t tail = m_tail.load(std::memory_order_relaxed);
+            if(tail - m_head.load(std::memory_order_acquire) > m_mask) return false;
+            std::swap(m_items[tail & m_mask], item);
+            m_tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /*!
+         * \brief Removes the item at the front of the queue by swapping it with item.
+         *  Consumer thread only.
+         * \param item Set to the removed item, its previous content is left in the slot.
+         * \return False if the queue was empty.
+         */
+        bool pop_swap(T & item)
+        {
+            size_t head = m_head.load(std::memory_order_relaxed);
+            if(head == m_tail.load(std::memory_order_acquire)) return false;
+            std::swap(m_items[head & m_mask], item);
+            m_head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /*!
+         * \brief Number of items in the queue. Only exact when called from the producer
+         *  or consumer thread while the other one is idle.
+         */
+        size_t size() const
+        {
+            return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+        }
+
+        size_t capacity() const { return m_items.size(); } //!< Get the capacity of the queue
+
+    private:
+
+        std::vector<T> m_items; //!< Ring buffer of items
+
+        size_t m_mask; //!< Capacity - 1 for wrapping the indices
+
+        std::atomic<size_t> m_head; //!< Number of items popped so far (written by the consumer)
+
+        char m_pad[64]; //!< Keeps the producer and consumer indices on separate cache lines
+
+        std::atomic<size_t> m_tail; //!< Number of items pushed so far (written by the producer)
+    };
+}
+
+#endif // SPSC_QUEUE_H
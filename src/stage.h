@@ -0,0 +1,428 @@
+/*! \file stage.h
+ *  \brief Pipeline stages wrapping the receiver chain blocks.
+ *
+ *  A stage connects a block to the chunk_rings it reads from and writes to so that the
+ *  block can run as soon as its input is available instead of in lock-step with the
+ *  rest of the chain. The functions driving the stages are shared by the receiver_chain
+ *  and the block_graph so that both run their stages the same way.
+ */
+
+#ifndef STAGE_H
+#define STAGE_H
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "block.h"
+#include "chunk_ring.h"
+
+namespace wno
+{
+    /*!
+     * \brief How a receiver chain or block_graph schedules its blocks
+     */
+    enum chain_schedule
+    {
+        LOCK_STEP, //!< Every block runs once per call to process_samples(), the buffers are swapped in between
+        PIPELINED, //!< Every block runs in its own thread as soon as a chunk is available in its input ring
+        WORK_STEALING, //!< Like PIPELINED but the blocks run as tasks on a work_stealing_pool instead of their own threads
+        DEPTH_FIRST, //!< Every chunk runs through all blocks in order on the caller's thread within one call to process_samples()
+    };
+
+    /*!
+     * \brief The stage_base class.
+     *
+     * Lets the receiver chain drive the stages through generic pointers even though
+     * their rings hold different item types. One call to the block's work function is
+     * done as #pull(), #work(), #push(). A stage may only be driven by one thread at a time.
+     */
+    class stage_base
+    {
+    public:
+
+        /*!
+         * \brief stage_base constructor
+         * \param stage_block The block run by this stage.
+         */
+        stage_base(block_base * stage_block) :
+            block(stage_block),
+            upstream(NULL),
+            downstream(NULL),
+            input_reader(NULL),
+            scheduled(false),
+            m_busy(false)
+        {
+        }
+
+        virtual ~stage_base() {}
+
+        /*!
+         * \brief Moves the next input chunk into the block.
+         * \return False if there was no input chunk.
+         */
+        virtual bool pull() = 0;
+
+        /*!
+         * \brief Moves the output of the block to the output ring. Outputs without items are
+         *  not pushed.
+         * \return False if the output ring was full.
+         */
+        virtual bool push() = 0;
+
+        virtual void wait_input() = 0; //!< Parks the thread until an input chunk may be available
+
+        virtual void wait_output() = 0; //!< Parks the thread until the output ring may have space
+
+        virtual bool input_empty() = 0; //!< Whether the input ring holds no chunk
+
+        virtual bool output_full() = 0; //!< Whether the output ring has no room for another chunk
+
+        void work() { block->prepare(); block->work(); } //!< Runs the block's work function on the pulled chunk
+
+        /*!
+         * \brief Lets the block produce the output it holds back once the input has run out.
+         *  Only called while the stage is idle and nothing can reach its input anymore.
+         * \return False if the block had nothing to output.
+         */
+        virtual bool finish() { return false; }
+
+        /*!
+         * \brief Gets the bytes of the chunks recycled through the input ring, assuming they
+         *  grow to the block's max_input items, plus the stage's own buffers.
+         */
+        virtual size_t buffer_footprint() = 0;
+
+        bool busy() { return m_busy; } //!< Whether a chunk was pulled and its output not pushed yet
+
+        block_base * block; //!< The block run by this stage
+
+        stage_base * upstream; //!< Stage feeding the input ring (NULL if it is fed by the receiver chain)
+
+        stage_base * downstream; //!< Stage reading the output ring (NULL if none or read by the receiver chain)
+
+        stage_base * input_reader; //!< Stage reading the input chunks this stage passes on (NULL if none)
+
+        std::atomic<bool> scheduled; //!< Whether the stage is queued or running on a work_stealing_pool
+
+    protected:
+
+        std::atomic<bool> m_busy; //!< Set between a successful #pull() and the following successful #push()
+                                  //!< (set before popping so that a chunk is always either in the ring or busy)
+    };
+
+    /*!
+     * \brief Copies a chunk for a ring added with add_output(). Items that can only be
+     *  moved, like rx_packet, come with an overload of their own.
+     * \param copy Set to a copy of chunk (keeping its storage).
+     * \param chunk The items.
+     */
+    template<typename T>
+    inline void copy_chunk(std::vector<T> & copy, const std::vector<T> & chunk)
+    {
+        copy.assign(chunk.begin(), chunk.end());
+    }
+
+    /*!
+     * \brief Stage running a block<I,O>.
+     *
+     * The output chunks go to the output ring, and a copy of each to every ring added
+     * with #add_output(). Without any output ring the output is dropped. The block's tags
+     * travel with its input and output chunks.
+     *
+     * With #pass_input() each input chunk is passed on once the block is done with it, so
+     * a tap can read the chunk behind the block without a copy.
+     */
+    template<typename I, typename O>
+    class block_stage : public stage_base
+    {
+    public:
+
+        /*!
+         * \brief Constructor for block_stage
+         * \param stage_block The block to run.
+         * \param input Ring the input chunks are popped from.
+         * \param output Ring the output chunks are pushed to (NULL if none).
+         */
+        block_stage(wno::block<I,O> * stage_block, chunk_ring<I> * input, chunk_ring<O> * output) :
+            stage_base(stage_block),
+            m_block(stage_block),
+            m_input(input),
+            m_output(output),
+            m_pass(NULL)
+        {
+        }
+
+        /*!
+         * \brief Adds a ring that gets a copy of every output chunk.
+         * \param output The ring.
+         */
+        void add_output(chunk_ring<O> * output) { m_copies.push_back(output); }
+
+        /*!
+         * \brief Passes every input chunk on to a ring, with its tags, once the block has run
+         *  on it. The block must not change its input.
+         * \param pass The ring, or NULL to recycle the input chunks into the input ring.
+         */
+        void pass_input(chunk_ring<I> * pass) { m_pass = pass; }
+
+        virtual bool pull()
+        {
+            m_busy = true;
+            if(!m_input->pop(m_block->input_buffer, m_block->input_tags)) m_busy = false;
+            return m_busy;
+        }
+
+        /*!
+         * Nothing is pushed unless every ring has room, so a failed push can simply be
+         * retried.
+         */
+        virtual bool push()
+        {
+            bool pass = m_pass && m_block->input_buffer.size();
+            if(pass && m_pass->full()) return false;
+            if(m_block->output_buffer.size())
+            {
+                if(output_full()) return false;
+                for(int x = 0; x < m_copies.size(); x++)
+                {
+                    copy_chunk(m_copy, m_block->output_buffer);
+                    m_copy_tags.assign(m_block->output_tags.begin(), m_block->output_tags.end());
+                    m_copies[x]->push(m_copy, m_copy_tags);
+                }
+                if(m_output) m_output->push(m_block->output_buffer, m_block->output_tags);
+                else
+                {
+                    m_block->output_buffer.clear();
+                    m_block->output_tags.clear();
+                }
+            }
+            if(pass) m_pass->push(m_block->input_buffer, m_block->input_tags);
+            m_busy = false;
+            return true;
+        }
+
+        virtual bool finish()
+        {
+            m_block->output_buffer.clear();
+            m_block->output_tags.clear();
+            m_block->finish();
+            if(m_block->output_buffer.empty()) return false;
+            m_busy = true;
+            return true;
+        }
+
+        /*!
+         * The block's own buffers are counted by the block.
+         */
+        virtual size_t buffer_footprint()
+        {
+            size_t bytes = m_input->depth() * m_block->max_input * sizeof(I);
+            if(m_copies.size()) bytes += m_block->max_output * sizeof(O);
+            return bytes;
+        }
+
+        virtual void wait_input() { m_input->wait_items(); }
+
+        virtual void wait_output()
+        {
+            if(m_output && m_output->full()) m_output->wait_space();
+            else if(m_pass && m_pass->full()) m_pass->wait_space();
+            else for(int x = 0; x < m_copies.size(); x++) if(m_copies[x]->full()) return m_copies[x]->wait_space();
+        }
+
+        virtual bool input_empty() { return m_input->empty(); }
+
+        virtual bool output_full()
+        {
+            if(m_output && m_output->full()) return true;
+            if(m_pass && m_pass->full()) return true;
+            for(int x = 0; x < m_copies.size(); x++) if(m_copies[x]->full()) return true;
+            return false;
+        }
+
+    private:
+
+        wno::block<I,O> * m_block; //!< The block run by this stage
+        chunk_ring<I> * m_input; //!< Ring the input chunks are popped from
+        chunk_ring<O> * m_output; //!< Ring the output chunks are pushed to (NULL if none)
+        chunk_ring<I> * m_pass; //!< Ring the input chunks are passed on to (NULL if none)
+        std::vector<chunk_ring<O> *> m_copies; //!< Rings getting a copy of the output chunks
+        std::vector<O> m_copy; //!< Recycled storage of the copies
+        std::vector<stream_tag> m_copy_tags; //!< Recycled storage of the copies' tags
+    };
+
+    /*!
+     * \brief Stage running a tap<I>.
+     *
+     * The stage owns the buffer the tap reads. If an output ring is given the chunk is
+     * passed on to it once the tap is done with it, which lets a block that depends on
+     * the tap's results run strictly behind it. Rings added with #add_output() get a copy.
+     */
+    template<typename I>
+    class tap_stage : public stage_base
+    {
+    public:
+
+        /*!
+         * \brief Constructor for tap_stage
+         * \param stage_tap The tap to run.
+         * \param input Ring the input chunks are popped from.
+         * \param output Ring the chunks are passed on to (NULL if none).
+         */
+        tap_stage(tap<I> * stage_tap, chunk_ring<I> * input, chunk_ring<I> * output = NULL) :
+            stage_base(stage_tap),
+            m_tap(stage_tap),
+            m_input(input),
+            m_output(output)
+        {
+            m_buffer.reserve(stage_tap->max_input);
+            stage_tap->connect(m_buffer);
+        }
+
+        /*!
+         * \brief Adds a ring that gets a copy of every chunk.
+         * \param output The ring.
+         */
+        void add_output(chunk_ring<I> * output) { m_copies.push_back(output); }
+
+        virtual bool pull()
+        {
+            m_busy = true;
+            if(!m_input->pop(m_buffer, m_tags)) m_busy = false;
+            return m_busy;
+        }
+
+        virtual bool push()
+        {
+            if(output_full()) return false;
+            for(int x = 0; x < m_copies.size(); x++)
+            {
+                copy_chunk(m_copy, m_buffer);
+                m_copy_tags.assign(m_tags.begin(), m_tags.end());
+                m_copies[x]->push(m_copy, m_copy_tags);
+            }
+            if(m_output) m_output->push(m_buffer, m_tags);
+            m_busy = false;
+            return true;
+        }
+
+        virtual void wait_input() { m_input->wait_items(); }
+
+        virtual void wait_output()
+        {
+            if(m_output && m_output->full()) m_output->wait_space();
+            else for(int x = 0; x < m_copies.size(); x++) if(m_copies[x]->full()) return m_copies[x]->wait_space();
+        }
+
+        virtual bool input_empty() { return m_input->empty(); }
+
+        virtual bool output_full()
+        {
+            if(m_output && m_output->full()) return true;
+            for(int x = 0; x < m_copies.size(); x++) if(m_copies[x]->full()) return true;
+            return false;
+        }
+
+        /*!
+         * The stage owns the buffer the tap reads, on top of the chunks in the input ring.
+         */
+        virtual size_t buffer_footprint()
+        {
+            size_t bytes = (m_input->depth() + 1) * m_tap->max_input * sizeof(I);
+            if(m_copies.size()) bytes += m_tap->max_input * sizeof(I);
+            return bytes;
+        }
+
+    private:
+
+        tap<I> * m_tap; //!< The tap run by this stage
+        std::vector<I> m_buffer; //!< The chunk being read by the tap
+        std::vector<stream_tag> m_tags; //!< The tags of the chunk, passed on with it
+        chunk_ring<I> * m_input; //!< Ring the input chunks are popped from
+        chunk_ring<I> * m_output; //!< Ring the chunks are passed on to (NULL if none)
+        std::vector<chunk_ring<I> *> m_copies; //!< Rings getting a copy of the chunks
+        std::vector<I> m_copy; //!< Recycled storage of the copies
+        std::vector<stream_tag> m_copy_tags; //!< Recycled storage of the copies' tags
+    };
+
+    /*!
+     * \brief Runs a stage forever on a thread of its own (PIPELINED schedule). The stage
+     *  waits for an input chunk, runs the block on it and waits for room in the output ring
+     *  if necessary.
+     * \param stage The stage to run.
+     */
+    inline void run_stage(stage_base * stage)
+    {
+        while(1)
+        {
+            while(!stage->pull()) stage->wait_input();
+            stage->work();
+            while(!stage->push()) stage->wait_output();
+        }
+    }
+
+    /*!
+     * \brief Runs stages in order on the caller's thread until their input rings are empty
+     *  (DEPTH_FIRST schedule).
+     *
+     * Each stage pushes at most one chunk per chunk it pulls and every stage after it is
+     * run before returning, so the rings never fill up and the pushes always succeed.
+     * \param stages The stages, each after the one feeding it.
+     * \param skip A stage running on a thread of its own instead (NULL if none).
+     */
+    inline void run_depth_first(const std::vector<stage_base *> & stages, const stage_base * skip = NULL)
+    {
+        for(size_t x = 0; x < stages.size(); x++)
+        {
+            stage_base * stage = stages[x];
+            if(stage == skip) continue;
+            while(stage->pull())
+            {
+                stage->work();
+                while(!stage->push()) stage->wait_output();
+            }
+        }
+    }
+
+    /*!
+     * \brief Waits until the stages have processed every chunk in their input rings and lets
+     *  each block output what it holds back (see block_base::finish()).
+     *
+     * The stages are checked upstream first. Once a stage's input ring is empty, it is not
+     * busy and it is not queued on a pool, nothing can reach the stages after it anymore, so
+     * one pass over the stages is enough. The idle stage is then marked as scheduled so that
+     * no pool worker runs it while its held back output is pushed from the calling thread,
+     * and its own thread, if any, stays parked on the empty input ring.
+     * \param stages The stages, each after the one feeding it.
+     * \param collect Called while waiting, empties the output ring of the last stage.
+     * \param resume Called with a stage whose held back output was pushed, gets the stages
+     *  after it going if they do not run on threads of their own.
+     */
+    template<typename Collect, typename Resume>
+    void flush_stages(const std::vector<stage_base *> & stages, Collect collect, Resume resume)
+    {
+        for(size_t x = 0; x < stages.size(); x++)
+        {
+            stage_base * stage = stages[x];
+            while(!stage->input_empty() || stage->busy() || stage->scheduled.exchange(true))
+            {
+                collect();
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+
+            bool finished = stage->finish();
+            while(finished && !stage->push())
+            {
+                collect();
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+            stage->scheduled = false;
+            if(finished) resume(stage);
+        }
+        collect();
+    }
+}
+
+#endif // STAGE_H
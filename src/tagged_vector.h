@@ -2,8 +2,8 @@
  *  \brief Header file for the tagged_vector template.
  *
  * This file contains the template classes for tagged vectors
- * and tagged samples that are used in the receiver chain's
- * input and output buffers.
+ * that are used in the receiver chain's input and output buffers,
+ * and the tags that go along with buffers of samples.
  *
  */
 
@@ -13,6 +13,7 @@
 #include <vector>
 #include <complex>
 #include <assert.h>
+#include <stdint.h>
 
 namespace wno
 {
@@ -32,6 +33,56 @@ namespace wno
         LTS2,           //!< Estimated beginning of second LTS symbol (64 samples after LTS1
         START_OF_FRAME, //!< Estimated beginning of frame i.e. Signal symbol (64 samples after LTS2)
         ULPN,
+        CHUNK_START,    //!< First sample of a chunk of the receiver chain's input, carries the chunk's stamp and the sample rate as value
+    };
+
+    /*!
+     * \brief The sample_stamp struct
+     *
+     * Locates a sample in the stream received from the radio independently of the chunk
+     * it happens to be in.
+     */
+    struct sample_stamp
+    {
+        uint64_t index;     //!< Absolute index of the sample, counting every sample received including dropped ones
+        double time;        //!< Device time of the sample in seconds, negative if the device did not report one
+
+        /*!
+         * \brief Constructor for sample_stamp
+         * \param _index -> #index
+         * \param _time -> #time
+         */
+        sample_stamp(uint64_t _index = 0, double _time = -1) :
+            index(_index),
+            time(_time)
+        {
+        }
+
+        /*!
+         * \brief Gets the stamp of a later sample.
+         * \param offset Number of samples after this one.
+         * \param rate Sample rate in samples per second, 0 if unknown (the time is then unknown too).
+         */
+        sample_stamp after(uint64_t offset, double rate) const
+        {
+            return sample_stamp(index + offset, (time >= 0 && rate > 0) ? time + offset / rate : -1);
+        }
+    };
+
+    /*!
+     * \brief The frame_metrics struct
+     *
+     * Measurements of a frame that the blocks take while the frame passes through them.
+     * Each block fills in what it measures anyway and passes the rest on.
+     */
+    struct frame_metrics
+    {
+        sample_stamp stamp; //!< Absolute index and device time of the #STS_START (frame_detector)
+        double rssi;        //!< Mean power of the STS in dB relative to a unit sample (frame_detector)
+        double cfo;         //!< Carrier frequency offset estimated from the LTS pair in radians per sample (timing_sync)
+        double snr;         //!< Signal to noise ratio of the LTS pair in dB (channel_est)
+
+        frame_metrics() : rssi(0), cfo(0), snr(0) {} //!< Constructor for empty frame_metrics
     };
 
     /*! \brief tagged_vector struct
@@ -46,6 +97,8 @@ namespace wno
 
         std::complex<double> samples[N]; //!< The array of N complex doubles
         vector_tag tag;                  //!< The array's tag
+        frame_metrics frame;             //!< Measurements of the frame (only set along with #LTS_START and #START_OF_FRAME)
+        double pilot_error;              //!< Squared error of the pilots after the phase correction (phase_tracker output only)
 
         /*!
          * \brief Non-initializing constructor for tagged_vector.
@@ -56,7 +109,7 @@ namespace wno
          * \param _tag optional initial #tag value. Default is #NONE if left out.
          * Default is NONE if left out
          */
-        tagged_vector(vector_tag _tag = NONE) { tag = _tag; }
+        tagged_vector(vector_tag _tag = NONE) { tag = _tag; pilot_error = 0; }
 
         /*!
          * \brief Initializing constructor for tagged_vector
@@ -72,26 +125,68 @@ namespace wno
             assert(_samples.size() == N);
             memcpy(&samples[0], &_samples[0], _samples.size() * sizeof(std::complex<double>));
             tag = _tag;
+            pilot_error = 0;
+        }
+    };
+
+    /*!
+     * \brief The stream_tag struct
+     *
+     * Marks one item of a buffer of samples. Instead of a tag per sample, the blocks pass
+     * each other a plain array of samples together with a short list of stream_tags sorted
+     * by offset, so the tagged samples are found by index and the samples stay contiguous.
+     */
+    struct stream_tag
+    {
+        size_t offset;      //!< Index of the tagged sample in its buffer
+        vector_tag tag;     //!< The tag
+        double value;       //!< Value measured by the block that set the tag (see the block), 0 if none
+        sample_stamp stamp; //!< Stamp of the tagged sample (#CHUNK_START and the tags of the frame_detector only)
+
+        /*!
+         * \brief Constructor for stream_tag
+         * \param _offset -> #offset
+         * \param _tag -> #tag
+         * \param _value -> #value
+         * \param _stamp -> #stamp
+         */
+        stream_tag(size_t _offset = 0, vector_tag _tag = NONE, double _value = 0, sample_stamp _stamp = sample_stamp()) :
+            offset(_offset),
+            tag(_tag),
+            value(_value),
+            stamp(_stamp)
+        {
         }
     };
 
     /*!
      * \brief The tagged_sample struct
      *
-     * A single complex double with a meta-data tag
+     * A single complex double with a meta-data tag. Blocks processing one sample at a time
+     * in a fused_pipeline hand these to each other, the buffers hold the samples and their
+     * stream_tags separately.
      */
     struct tagged_sample
     {
         std::complex<double> sample; //!< The complex sample
         vector_tag tag;              //!< The sample's tag
+        double value;                //!< The tag's value, see stream_tag::value
+        sample_stamp stamp;          //!< The tag's stamp, see stream_tag::stamp
 
         /*!
          * \brief Constructor for tagged_sample
-         *
-         * Does not initialize the sample to anything
-         * Initializes the tag to #NONE
+         * \param _sample -> #sample
+         * \param _tag -> #tag
+         * \param _value -> #value
+         * \param _stamp -> #stamp
          */
-        tagged_sample() { tag = NONE; }
+        tagged_sample(std::complex<double> _sample = 0, vector_tag _tag = NONE, double _value = 0, sample_stamp _stamp = sample_stamp()) :
+            sample(_sample),
+            tag(_tag),
+            value(_value),
+            stamp(_stamp)
+        {
+        }
     };
 }
 
@@ -0,0 +1,81 @@
+/*! \file thread_pool.cpp
+ *  \brief C++ file for the thread_pool class.
+ *
+ *  The thread_pool class holds a fixed set of worker threads that can be used
+ *  to split data parallel work such as a correlation search over a block of
+ *  samples across several cores.
+ */
+
+#include <algorithm>
+
+#include "thread_pool.h"
+
+namespace wno
+{
+    /*!
+     * Creates a wake semaphore and a thread for each worker. The semaphores are
+     * sized before any thread starts so that they never move in memory.
+     */
+    thread_pool::thread_pool(int num_threads) :
+        m_wake_sems(num_threads),
+        m_task(NULL),
+        m_count(0),
+        m_next(0),
+        m_stop(false)
+    {
+        sem_init(&m_done_sem, 0, 0);
+        for(int x = 0; x < num_threads; x++) sem_init(&m_wake_sems[x], 0, 0);
+        for(int x = 0; x < num_threads; x++) m_threads.push_back(std::thread(&thread_pool::run_worker, this, x));
+    }
+
+    thread_pool::~thread_pool()
+    {
+        m_stop = true;
+        for(int x = 0; x < size(); x++) sem_post(&m_wake_sems[x]);
+        for(int x = 0; x < size(); x++) m_threads[x].join();
+        for(int x = 0; x < size(); x++) sem_destroy(&m_wake_sems[x]);
+        sem_destroy(&m_done_sem);
+    }
+
+    /*!
+     * Only wakes up as many workers as there are tasks beyond the one the calling
+     * thread is going to run itself. The tasks are claimed dynamically so a slow
+     * worker does not hold up the others.
+     */
+    void thread_pool::parallel_for(int count, const std::function<void(int)> & task)
+    {
+        if(count <= 0) return;
+
+        m_task = &task;
+        m_count = count;
+        m_next.store(0);
+
+        int woken = std::min(count - 1, size());
+        for(int x = 0; x < woken; x++) sem_post(&m_wake_sems[x]);
+
+        run_tasks();
+
+        for(int x = 0; x < woken; x++) sem_wait(&m_done_sem);
+        m_task = NULL;
+    }
+
+    void thread_pool::run_worker(int index)
+    {
+        while(1)
+        {
+            sem_wait(&m_wake_sems[index]);
+            if(m_stop) return;
+            run_tasks();
+            sem_post(&m_done_sem);
+        }
+    }
+
+    void thread_pool::run_tasks()
+    {
+        int index;
+        while((index = m_next.fetch_add(1)) < m_count)
+        {
+            (*m_task)(index);
+        }
+    }
+}
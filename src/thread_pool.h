@@ -0,0 +1,83 @@
+/*! \file thread_pool.h
+ *  \brief Header file for the thread_pool class.
+ *
+ *  The thread_pool class holds a fixed set of worker threads that can be used
+ *  to split data parallel work such as a correlation search over a block of
+ *  samples across several cores.
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+#include <semaphore.h>
+
+namespace wno
+{
+    /*!
+     * \brief The thread_pool class.
+     *
+     * Usage: call #parallel_for() with the number of tasks and a function taking
+     * the task index. The tasks are shared between the worker threads and the calling
+     * thread, and #parallel_for() returns once every task has finished. Only one
+     * thread may call #parallel_for() on a given pool at a time.
+     */
+    class thread_pool
+    {
+    public:
+
+        /*!
+         * \brief Constructor for thread_pool
+         * \param num_threads Number of worker threads in addition to the calling thread.
+         */
+        thread_pool(int num_threads);
+
+        /*!
+         * \brief Destructor for thread_pool. Stops and joins the worker threads.
+         */
+        ~thread_pool();
+
+        /*!
+         * \brief Runs task(0) .. task(count-1) on the pool and the calling thread.
+         * \param count Number of tasks to run.
+         * \param task Function to run for each task index.
+         */
+        void parallel_for(int count, const std::function<void(int)> & task);
+
+        int size() { return m_threads.size(); } //!< Get the number of worker threads
+
+    private:
+
+        /*!
+         * \brief Main loop for each worker thread. Waits to be woken up and then
+         *  runs tasks until there are none left.
+         * \param index The worker's index for referencing its wake semaphore.
+         */
+        void run_worker(int index);
+
+        /*!
+         * \brief Claims and runs tasks from the current #parallel_for() call until
+         *  there are none left.
+         */
+        void run_tasks();
+
+        std::vector<std::thread> m_threads; //!< The worker threads
+
+        std::vector<sem_t> m_wake_sems; //!< Semaphores used to "wake up" each worker
+
+        sem_t m_done_sem; //!< Posted by each worker once it runs out of tasks
+
+        const std::function<void(int)> * m_task; //!< Task of the current #parallel_for() call
+
+        int m_count; //!< Number of tasks in the current #parallel_for() call
+
+        std::atomic<int> m_next; //!< Index of the next unclaimed task
+
+        bool m_stop; //!< Tells the woken workers to exit
+    };
+}
+
+#endif // THREAD_POOL_H
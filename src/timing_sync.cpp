@@ -21,17 +21,16 @@ namespace wno
      * - Initializations:
      *   + #m_phase_acc -> 0.0
      *   + #m_phase_offset -> 0.0
-     *   + #m_carryover -> 160 blank tagged samples
+     *   + history -> the last #LOOKBACK_LENGTH + #LOOKAHEAD_LENGTH input samples (blank at first)
+     *   + buffers -> max_input samples in and out
      */
-    timing_sync::timing_sync() :
-        block("timing_sync"),
+    timing_sync::timing_sync(size_t max_input) :
+        block("timing_sync", max_input, max_input, LOOKBACK_LENGTH + LOOKAHEAD_LENGTH),
         m_phase_acc(0),
         m_phase_offset(0),
-        m_carryover(CARRYOVER_LENGTH, tagged_sample())
+        m_received(0)
     {}
 
-    int lts_count = 0;
-
     /*!
      * Once this block detects the #STS_END flag in the input samples it begins
      * correlating the input with the known #LTS_TIME_DOMAIN_CONJ samples to find
@@ -47,96 +46,117 @@ namespace wno
      * It then applies the offset correction to all subsequent samples until the next
      * frame is detected and a new estimation is calculated.
      *
+     * The block works on the #input_window, i.e. it runs #LOOKAHEAD_LENGTH samples behind
+     * its input so that the LTS search following an #STS_END always has the samples it
+     * needs (up to the end of the second LTS symbol), and outputs each sample another
+     * #LOOKBACK_LENGTH samples later since the #LTS1 tag may come up to 8 samples before
+     * the #STS_END. The corrections in the history stay there for the next call and the
+     * tags are kept in #m_tags until their samples are output.
+     *
+     * The #LTS1 tag carries the frequency offset estimated from the LTS pair (in radians per
+     * sample) as value and the #LTS2 tag the normalized LTS correlation of the stronger peak.
+     * The tags of the input are passed on as they are, stamps included.
      */
     void timing_sync::work()
     {
 
-        if(input_buffer.size() == 0) return;
-        assert(input_buffer.size() > CARRYOVER_LENGTH);
-        output_buffer.resize(input_buffer.size());
+        output_tags.resize(0);
+        if(input_buffer.size() == 0)
+        {
+            output_buffer.resize(0);
+            return;
+        }
 
-        std::vector<tagged_sample> input(input_buffer.size() + CARRYOVER_LENGTH);
+        for(int t = 0; t < input_tags.size(); t++)
+        {
+            stream_tag tag = input_tags[t];
+            tag.offset += m_received;
+            set_tag(tag);
+        }
 
-        memcpy(&input[0],
-               &m_carryover[0],
-               CARRYOVER_LENGTH*sizeof(tagged_sample));
+        // The lookahead of the previous calls followed by the input_buffer
+        int64_t first = (int64_t)m_received - LOOKAHEAD_LENGTH;
+        m_received += input_buffer.size();
+        correct(input_window + LOOKBACK_LENGTH, first, input_buffer.size());
 
-        memcpy(&input[CARRYOVER_LENGTH],
-               &input_buffer[0],
-               input_buffer.size() * sizeof(tagged_sample));
+        // The output starts LOOKBACK_LENGTH samples before the first corrected one
+        int64_t output_start = first - LOOKBACK_LENGTH;
+        output_buffer.assign(input_window, input_window + input_buffer.size());
 
-        for(int x = 0; x < input.size() - CARRYOVER_LENGTH; x++)
+        int taken = 0;
+        while(taken < m_tags.size() && (int64_t)m_tags[taken].offset < output_start + (int64_t)input_buffer.size())
         {
-            // End of STS found: Look for LTS peaks
-            if(input[x].tag == STS_END)
+            if((int64_t)m_tags[taken].offset >= output_start)
             {
-                // Cross correlate against the LTS
-                std::vector<std::pair<double, int> > peaks;
-                for(int p = x; p < x + CARRYOVER_LENGTH - LTS_LENGTH; p++)
-                {
-                    std::complex<double> corr(0, 0);
-                    double power = 0;
-                    for(int s = 0; s < 64; s++)
-                    {
-                        corr += input[p+s].sample * LTS_TIME_DOMAIN_CONJ[s] /* complex conjugate of LTS */;
-                        power += std::norm(input[p+s].sample);
-                    }
-                    double corr_norm = std::abs(corr) / power;
-                    if(corr_norm > LTS_CORR_THRESHOLD) peaks.push_back(std::pair<double, int>(corr_norm, p));
-                }
+                output_tags.push_back(m_tags[taken]);
+                output_tags.back().offset -= output_start;
+            }
+            taken++;
+        }
+        m_tags.erase(m_tags.begin(), m_tags.begin() + taken);
+    }
 
-                std::sort(peaks.begin(), peaks.end());
-                std::reverse(peaks.begin(), peaks.end());
+    void timing_sync::set_tag(const stream_tag & tag)
+    {
+        std::vector<stream_tag>::iterator it = m_tags.begin();
+        while(it != m_tags.end() && it->offset < tag.offset) it++;
+        if(it != m_tags.end() && it->offset == tag.offset) *it = tag;
+        else m_tags.insert(it, tag);
+    }
 
-                // Look for two peaks, 64 samples apart
-                bool found = false;
-                int jump = 5;
-                for(int s = 0; s < std::min((int)peaks.size(), 3) && !found; s+=jump)
-                {
-                    for(int t = s; t < std::min((int)peaks.size(), s+jump) && !found; t++)
-                    {
-                        if(std::abs(peaks[s].second - peaks[t].second) == 64)
-                        {
-                            // Determine the LTS offset
-                            found = true;
-                            int lts_offset = std::min(peaks[s].second, peaks[t].second) - 32; // Start of the LTS CP
-                            if(lts_offset < 0) break;
-
-                            input[lts_offset+24].tag = LTS1; // First sample in the LTS
-                            input[lts_offset+24+64].tag = LTS2; // First sample in the LTS
-
-                            std::complex<double> auto_corr_acc(0.0, 0.0);
-                            for(int k = LTS1; k < LTS1; k++)
-                            {
-                                auto_corr_acc += input[k].sample * std::conj(input[k+LTS_LENGTH].sample);
-                            }
-
-                            m_phase_offset = std::arg(auto_corr_acc) / 64.0;
-                            m_phase_acc = std::arg(input[lts_offset + 32 + LTS_LENGTH*2 -1].sample * LTS_TIME_DOMAIN_CONJ[63]);
-                        }
-                    }
-                }
+    void timing_sync::search_lts(std::complex<double> * window, int64_t index)
+    {
+        // Cross correlate against the LTS
+        std::vector<std::pair<double, int> > peaks;
+        for(int p = 0; p < CARRYOVER_LENGTH - LTS_LENGTH; p++)
+        {
+            std::complex<double> corr(0, 0);
+            double power = 0;
+            for(int s = 0; s < 64; s++)
+            {
+                corr += window[p+s] * LTS_TIME_DOMAIN_CONJ[s] /* complex conjugate of LTS */;
+                power += std::norm(window[p+s]);
             }
+            double corr_norm = std::abs(corr) / power;
+            if(corr_norm > LTS_CORR_THRESHOLD) peaks.push_back(std::pair<double, int>(corr_norm, p));
+        }
 
-            m_phase_acc += m_phase_offset;
-            while(m_phase_acc > 2.0*M_PI) m_phase_acc -= 2.0*M_PI;
-            while(m_phase_acc < -2.0*M_PI) m_phase_acc += 2.0*M_PI;
-            std::complex<double> phase_correction(std::cos(m_phase_acc), std::sin(m_phase_acc));
-            input[x].sample *= phase_correction;
+        std::sort(peaks.begin(), peaks.end());
+        std::reverse(peaks.begin(), peaks.end());
 
-        }
+        // Look for two peaks, 64 samples apart
+        bool found = false;
+        int jump = 5;
+        for(int s = 0; s < std::min((int)peaks.size(), 3) && !found; s+=jump)
+        {
+            for(int t = s; t < std::min((int)peaks.size(), s+jump) && !found; t++)
+            {
+                if(std::abs(peaks[s].second - peaks[t].second) == 64)
+                {
+                    // Determine the LTS offset
+                    found = true;
+                    int lts_offset = std::min(peaks[s].second, peaks[t].second) - 32; // Start of the LTS CP (at least -LOOKBACK_LENGTH)
 
-        // Copy working samples to output
-        memcpy(&output_buffer[0],
-               &input[0],
-               input_buffer.size() * sizeof(tagged_sample));
+                    // The two LTS symbols are identical, so their phase difference is the rotation over 64 samples
+                    std::complex<double> auto_corr_acc(0.0, 0.0);
+                    for(int k = lts_offset + 32; k < lts_offset + 32 + LTS_LENGTH; k++)
+                    {
+                        auto_corr_acc += window[k] * std::conj(window[k+LTS_LENGTH]);
+                    }
 
-        // Carryover last 160 samples from input buffer
-        memcpy(&m_carryover[0],
-               &input[input_buffer.size()],
-               CARRYOVER_LENGTH * sizeof(tagged_sample));
+                    // Only reported with the frame: the residual rotation is left to the phase_tracker since
+                    // derotating by this estimate costs frames at low SNR (m_phase_offset stays 0)
+                    double cfo = -std::arg(auto_corr_acc) / 64.0;
 
-    }
+                    // Tags before the first sample could only come from the blank history
+                    int64_t lts1 = index + lts_offset + 24; // First sample in the LTS
+                    if(lts1 >= 0) set_tag(stream_tag(lts1, LTS1, cfo));
+                    if(lts1 + 64 >= 0) set_tag(stream_tag(lts1 + 64, LTS2, peaks[s].first)); // First sample in the LTS
 
+                    m_phase_acc = std::arg(window[lts_offset + 32 + LTS_LENGTH*2 -1] * LTS_TIME_DOMAIN_CONJ[63]);
+                }
+            }
+        }
+    }
 
 }
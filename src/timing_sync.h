@@ -12,8 +12,13 @@
 #define LTS_CORR_THRESHOLD 0.9
 #define CARRYOVER_LENGTH 160
 #define LTS_LENGTH 64
+#define LOOKAHEAD_LENGTH (CARRYOVER_LENGTH + LTS_LENGTH) // Samples the LTS search may read past an STS_END
+#define LOOKBACK_LENGTH 32 // Samples before an STS_END the LTS search may tag
 
+#include <cmath>
 #include <complex>
+#include <vector>
+#include <stdint.h>
 
 #include "block.h"
 #include "tagged_vector.h"
@@ -23,33 +28,140 @@ namespace wno
     /*!
      * \brief The timing_sync block.
      *
-     * Inputs tagged samples from the frame_detector block.
-     * Outputs tagged samples to the fft_symbols block.
+     * Inputs samples and their stream_tags from the frame_detector block.
+     * Outputs the corrected samples and their stream_tags, now including the LTS, to the fft_symbols block.
      *
      * The timing sync block is in charge of using the two LTS symbols to align the received frame in time.
      * It also uses the two LTS symbols to perform an initial frequency offset estimation and
      * applying the necessary correction.
      */
-    class timing_sync : public wno::block<tagged_sample, tagged_sample>
+    class timing_sync : public wno::block<std::complex<double>, std::complex<double> >
     {
     public:
 
-        timing_sync(); //!< Constructor for timing_sync block.
+        /*!
+         * \brief Constructor for timing_sync block.
+         * \param max_input Most samples per call to work().
+         */
+        timing_sync(size_t max_input = BUFFER_MAX);
 
         virtual void work(); //!< Signal processing happens here.
 
+        /*!
+         * \brief Processes one sample. The output runs #LOOKBACK_LENGTH + #LOOKAHEAD_LENGTH
+         *  samples behind the input.
+         * \param sample The input sample.
+         * \param sink Called with the tagged output sample.
+         */
+        template<typename Sink>
+        void process(const tagged_sample & sample, Sink & sink)
+        {
+            if(sample.tag != NONE) set_tag(stream_tag(m_received, sample.tag, sample.value, sample.stamp));
+            std::complex<double> * window = append_history(&sample.sample, 1);
+            int64_t first = (int64_t)m_received++ - LOOKAHEAD_LENGTH;
+            correct(window + LOOKBACK_LENGTH, first, 1);
+
+            tagged_sample out(window[0]);
+            while(m_tags.size() && (int64_t)m_tags[0].offset <= first - LOOKBACK_LENGTH)
+            {
+                if((int64_t)m_tags[0].offset == first - LOOKBACK_LENGTH)
+                {
+                    out.tag = m_tags[0].tag;
+                    out.value = m_tags[0].value;
+                    out.stamp = m_tags[0].stamp;
+                }
+                m_tags.erase(m_tags.begin());
+            }
+            sink(out);
+        }
+
     private:
 
-        double m_phase_offset; //!< The phase rotation from symbol to symbol
+        /*!
+         * \brief Corrects the frequency offset of consecutive samples, searching the LTS at
+         *  every #STS_END among them first.
+         * \param samples The samples, preceded by #LOOKBACK_LENGTH and followed by
+         *  #LOOKAHEAD_LENGTH samples of the window. The LTS tags are set on the window.
+         * \param first Absolute index of the first sample.
+         * \param count Number of samples.
+         */
+        void correct(std::complex<double> * samples, int64_t first, size_t count);
 
-        double m_phase_acc; //!< The total phase rotation for the current symbol
+        /*!
+         * \brief Rotates consecutive samples by the accumulated phase offset.
+         * \param samples The samples.
+         * \param count Number of samples.
+         */
+        void rotate(std::complex<double> * samples, size_t count);
+
+        /*!
+         * \brief Searches the LTS following the #STS_END at window[0], tags it and
+         *  estimates the frequency offset.
+         * \param window Points at the #STS_END, preceded by #LOOKBACK_LENGTH samples.
+         * \param index Absolute index of the #STS_END.
+         */
+        void search_lts(std::complex<double> * window, int64_t index);
 
         /*!
-         * \brief Vector for storing the last 160 samples from the input_buffer
-         * and carrying them over to the next call to #work()
+         * \brief Adds a tag to #m_tags. A tag already set on the same sample is replaced.
+         * \param tag The tag, its offset is the absolute index of the sample.
          */
-        std::vector<tagged_sample> m_carryover;
+        void set_tag(const stream_tag & tag);
+
+        double m_phase_offset; //!< The phase rotation from symbol to symbol
+
+        double m_phase_acc; //!< The total phase rotation for the current symbol
+
+        uint64_t m_received; //!< Number of samples received so far, i.e. the absolute index of the next input sample
+
+        std::vector<stream_tag> m_tags; //!< Tags of the samples in the window not output yet, by absolute index
     };
+
+    /*!
+     * The samples between two #STS_END tags are rotated in one go, so the tags are only
+     * looked up once per run instead of once per sample.
+     */
+    inline void timing_sync::correct(std::complex<double> * samples, int64_t first, size_t count)
+    {
+        size_t x = 0;
+        while(x < count)
+        {
+            // Find the next STS_END in the range
+            size_t end = count;
+            for(int t = 0; t < m_tags.size(); t++)
+            {
+                int64_t index = (int64_t)m_tags[t].offset;
+                if(m_tags[t].tag == STS_END && index >= first + (int64_t)x && index < first + (int64_t)count)
+                {
+                    end = index - first;
+                    break;
+                }
+            }
+
+            rotate(samples + x, end - x);
+            x = end;
+
+            // End of STS found: Look for LTS peaks
+            if(x < count)
+            {
+                search_lts(samples + x, first + x);
+                rotate(samples + x, 1);
+                x++;
+            }
+        }
+    }
+
+    inline void timing_sync::rotate(std::complex<double> * samples, size_t count)
+    {
+        for(size_t x = 0; x < count; x++)
+        {
+            m_phase_acc += m_phase_offset;
+            while(m_phase_acc > 2.0*M_PI) m_phase_acc -= 2.0*M_PI;
+            while(m_phase_acc < -2.0*M_PI) m_phase_acc += 2.0*M_PI;
+            std::complex<double> phase_correction(std::cos(m_phase_acc), std::sin(m_phase_acc));
+            samples[x] *= phase_correction;
+        }
+    }
 }
 
 #endif // TIMING_SYNC_H
@@ -1,57 +1,83 @@
+/*! \file underlay.cpp
+ *  \brief C++ file for the underlay.
+ *
+ *  The underlay class adds a low power PN sequence underneath the transmitted OFDM
+ *  frames. The noise_injector class adds the simulated receiver noise that used to be
+ *  added together with the underlay.
+ */
+
+#include <algorithm>
+#include <emmintrin.h>
+
 #include "underlay.h"
-#include <numeric>
-#include <iostream>
-#include <cstdlib>
-#include <ctime>
-#include <random>
 
-#define TOTAL_SIZE 240
 #define UL_AMP 0.0156 // -17dB
 #define NO_AMP 0.0111 // -20dB
 namespace wno
 {
-    underlay::underlay()
+    underlay::underlay() :
+        underlay(UL_AMP)
     {
     }
-    std::vector<std::complex<double> > underlay::add_underlay(std::vector<std::complex<double> > overlay_data)
+
+    /*!
+     * - Initializations:
+     *   + #m_pn -> SPNS with pn_length chips
+     *   + #m_waveform -> amplitude * PN followed by -amplitude * PN
+     *   + #m_phase -> start of the positive period
+     */
+    underlay::underlay(double amplitude, int pn_length) :
+        m_pn(pn_length),
+        m_waveform(2 * pn_length),
+        m_phase(0)
     {
-        std::vector<double>abs_data(overlay_data.size());// = std::abs(overlay_data);
-        std::cout << "Buffer of size "<< overlay_data.size() << std::endl;
-        std::srand(std::time(0)); // use current time as seed for random generator
-        // for(int x = 0; x < overlay_data.size(); x++)
-        // {
-        //     abs_data[x] = std::abs(overlay_data[x]);
-        //     std::cout << "Abs  " << abs_data[x] << std::endl;
-        // }
-        // double sum = std::accumulate(abs_data.begin(), abs_data.end(), 0.0);
-        // std::cout << "Sum of data in buffer of size "<< overlay_data.size()<< " is " << sum << std::endl;
-        // Assuming that average amplitude of overlay_data is ~0.1
-        int z = 0;
-        int polarity = 1; // transmit alternate +1 and -1
-        double noise;
-        std::default_random_engine generator;
-        std::normal_distribution<double> distribution(NO_AMP,0.1*NO_AMP);
-        std::vector<std::complex<double> > output = overlay_data;
-        for(int x = 0; x < overlay_data.size(); x++)
+        const std::vector<double> & chips = m_pn.real();
+        for(int x = 0; x < pn_length; x++)
         {
-            abs_data[x] = std::abs(overlay_data[x]);
-            // Add 240 240 80 80 80 ......
-            output[x] += std::complex<double>(polarity*UL_AMP,0)*SPNS[z]; // adding signal 12dB below
-            noise = distribution(generator);
-            output[x] += std::complex<double>(noise,0); // Only for simulation 
-            z++;
-            if(z>pnSize-1)
+            m_waveform[x] = amplitude * chips[x];
+            m_waveform[x + pn_length] = -amplitude * chips[x];
+        }
+    }
+
+    /*!
+     * The waveform is added in runs up to its end, then wraps around. Each complex
+     * double fills one SSE register so a sample is a single packed add.
+     */
+    void underlay::add_underlay(std::complex<double> * samples, size_t count)
+    {
+        double * out = reinterpret_cast<double *>(samples);
+        while(count)
+        {
+            size_t run = std::min(count, m_waveform.size() - m_phase);
+            const double * ul = reinterpret_cast<const double *>(&m_waveform[m_phase]);
+            for(size_t x = 0; x < 2 * run; x += 2)
             {
-                z=0;
-                polarity  = 0-polarity;
+                _mm_storeu_pd(out + x, _mm_add_pd(_mm_loadu_pd(out + x), _mm_loadu_pd(ul + x)));
             }
+            out += 2 * run;
+            count -= run;
+            m_phase += run;
+            if(m_phase == m_waveform.size()) m_phase = 0;
         }
-        return output;
     }
-    
+
     std::vector<std::complex<double> > underlay::decode_underlay(std::vector<std::complex<double> > rx_overlay_data)
     {
         std::vector<std::complex<double> > output = rx_overlay_data;
         return output;
     }
+
+    noise_injector::noise_injector(unsigned int seed) :
+        m_generator(seed),
+        m_distribution(NO_AMP, 0.1 * NO_AMP)
+    {
+    }
+
+    void noise_injector::add_noise(std::complex<double> * samples, size_t count)
+    {
+        for(size_t x = 0; x < count; x++)
+        {
+            samples[x] += std::complex<double>(m_distribution(m_generator), 0);
+        }
+    }
 }
@@ -1,4148 +1,104 @@
 /*! \file underlay.h
  *  \brief Header file for the underlay.
+ *
+ *  The underlay class adds a low power PN sequence underneath the transmitted OFDM
+ *  frames. The noise_injector class adds the simulated receiver noise that used to be
+ *  added together with the underlay.
  */
 
-#include <complex>
-#include <vector>
-
-#define pnSize 2048
-
 #ifndef UNDERLAY_H
 #define UNDERLAY_H
 
-#endif // UNDERLAY_H
+#include <complex>
+#include <vector>
+#include <random>
+#include <stddef.h>
+
+#include "pn_sequence.h"
 
 namespace wno
 {
     /*!
-     * Some info about the underlay block
+     * \brief The underlay modulator.
+     *
+     * Adds a PN sequence (SPNS of the given length) at a fixed amplitude to the samples,
+     * alternating the polarity of every PN period. The waveform of two periods (positive then negative polarity) is
+     * computed once in the constructor, so adding the underlay is a single vector add.
+     * The position in the waveform is kept between calls, so the PN phase and polarity
+     * continue across frames instead of restarting at every frame.
      */
-    static std::complex<double> SPNS[2048] =
+    class underlay
     {
-        
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(1,  0 ),
-std::complex<double>(-1,  0 )
-    };
-    // static std::complex<double> SPNS[1024] =
-    // {
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 )        
-    // };
-    // static std::complex<double> SPNS[512] =
-    // {
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 )        
-    // };
-    // static std::complex<double> SPNS[256] =
-    // {
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 )
-    // };
-    // static std::complex<double> SPNS[128] =
-    // {
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 )
-    // };
-    // static std::complex<double> SPNS[64] =
-    // {
-    //     std::complex<double>( 0,  0 ),
-    //     std::complex<double>( 0,  0 ),
-    //     std::complex<double>( 0,  0 ),
-    //     std::complex<double>( 0,  0 ),
-    //     std::complex<double>( 0,  0 ),
-    //     std::complex<double>( 0,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>( 0,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>(-1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>( 1,  0 ),
-    //     std::complex<double>( 0,  0 ),
-    //     std::complex<double>( 0,  0 ),
-    //     std::complex<double>( 0,  0 ),
-    //     std::complex<double>( 0,  0 ),
-    //     std::complex<double>( 0,  0 )
-    // };
-    static int SPNRep = 4;
+        public:
 
-    static std::complex<double> LPNS[64] =
-    {
-        std::complex<double>( 0,  0 ),
-        std::complex<double>( 0,  0 ),
-        std::complex<double>( 0,  0 ),
-        std::complex<double>( 0,  0 ),
-        std::complex<double>( 0,  0 ),
-        std::complex<double>( 0,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>(-1,  0 ),
-        std::complex<double>(-1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>(-1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>(-1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>(-1,  0 ),
-        std::complex<double>(-1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>(-1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>(-1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>( 0,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>(-1,  0 ),
-        std::complex<double>(-1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>(-1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>(-1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>(-1,  0 ),
-        std::complex<double>(-1,  0 ),
-        std::complex<double>(-1,  0 ),
-        std::complex<double>(-1,  0 ),
-        std::complex<double>(-1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>(-1,  0 ),
-        std::complex<double>(-1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>(-1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>(-1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>( 1,  0 ),
-        std::complex<double>( 0,  0 ),
-        std::complex<double>( 0,  0 ),
-        std::complex<double>( 0,  0 ),
-        std::complex<double>( 0,  0 ),
-        std::complex<double>( 0,  0 )
+            /*!
+             * \brief Constructor for underlay modulator.
+             * \param amplitude Amplitude of the PN chips.
+             * \param pn_length Length of the PN sequence.
+             */
+            underlay(double amplitude, int pn_length = DEFAULT_PN_LENGTH);
+
+            underlay(); //!< Constructor for underlay modulator with the default amplitude.
+
+            /*!
+             * \brief Adds the next count samples of the underlay in place.
+             * \param samples The samples to add the underlay to.
+             * \param count Number of samples.
+             */
+            void add_underlay(std::complex<double> * samples, size_t count);
+
+            /*!
+             * \brief Adds the next samples of the underlay in place to a whole buffer.
+             */
+            void add_underlay(std::vector<std::complex<double> > & samples) { if(samples.size()) add_underlay(&samples[0], samples.size()); }
+
+            void reset() { m_phase = 0; } //!< Restarts the underlay at the start of a positive period
+
+            int pn_length() const { return m_pn.length(); } //!< Get the length of the PN sequence
+
+            const pn_sequence & pn() const { return m_pn; } //!< Get the PN sequence
+
+            std::vector<std::complex<double> > decode_underlay(std::vector<std::complex<double> > overlay_data);
+
+        private:
+
+            pn_sequence m_pn; //!< The PN sequence
+            std::vector<std::complex<double> > m_waveform; //!< One positive and one negative PN period
+            size_t m_phase; //!< Position in #m_waveform of the next sample
     };
 
-    class underlay
+    /*!
+     * \brief Simulated receiver noise.
+     *
+     * Adds gaussian noise (mean NO_AMP, deviation 0.1 * NO_AMP) to the real part of the
+     * samples. Only meant for simulation, the transmit path does not use it. The generator
+     * is seeded once so the noise is reproducible and continues across calls.
+     */
+    class noise_injector
     {
         public:
-            underlay();
-            std::vector<std::complex<double> > add_underlay(std::vector<std::complex<double> > overlay_data);
-            std::vector<std::complex<double> > decode_underlay(std::vector<std::complex<double> > overlay_data);
+
+            /*!
+             * \brief Constructor for noise_injector.
+             * \param seed Seed of the random generator.
+             */
+            noise_injector(unsigned int seed = std::default_random_engine::default_seed);
+
+            /*!
+             * \brief Adds noise in place to count samples.
+             */
+            void add_noise(std::complex<double> * samples, size_t count);
+
+            /*!
+             * \brief Adds noise in place to a whole buffer.
+             */
+            void add_noise(std::vector<std::complex<double> > & samples) { if(samples.size()) add_noise(&samples[0], samples.size()); }
+
+        private:
+
+            std::default_random_engine m_generator; //!< Noise generator
+            std::normal_distribution<double> m_distribution; //!< Noise distribution
     };
 }
+
+#endif // UNDERLAY_H
@@ -0,0 +1,163 @@
+/*! \file underlay_canceller.cpp
+ *  \brief C++ file for the Underlay Canceller block.
+ *
+ *  The underlay canceller block removes the underlay PN sequences found by the
+ *  underlay_decode block from the samples before they reach the frame_detector
+ *  (successive interference cancellation).
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#include "underlay_canceller.h"
+
+#define DECISION_QUEUE_SIZE 1024
+
+namespace wno
+{
+    /*!
+     * - Initializations:
+     *   + #m_decisions -> room for #DECISION_QUEUE_SIZE decisions
+     *   + #m_max_length -> length of the longest PN sequence
+     *   + #m_pending -> room for max_input input samples plus the held back samples (at most
+     *     the previous chunk and one PN period)
+     *   + buffers -> max_input samples in and out (the output is at most the previous chunk)
+     */
+    underlay_canceller::underlay_canceller(const std::vector<std::vector<std::complex<double> > > & codes, size_t max_input) :
+        block("underlay_canceller", max_input, max_input),
+        m_codes(codes),
+        m_decisions(DECISION_QUEUE_SIZE),
+        m_max_length(max_length(codes)),
+        m_received(0),
+        m_pending_memory((2 * max_input + max_length(codes) + 1) * sizeof(std::complex<double>), sizeof(std::complex<double>)),
+        m_pending(static_cast<std::complex<double> *>(m_pending_memory.data())),
+        m_pending_capacity(m_pending_memory.size() / sizeof(std::complex<double>)),
+        m_pending_first(0),
+        m_pending_count(0),
+        m_pending_start(0),
+        m_pending_tag_first(0),
+        m_cancelled(0),
+        m_dropped(0)
+    {
+        m_waiting.reserve(DECISION_QUEUE_SIZE);
+    }
+
+    int underlay_canceller::max_length(const std::vector<std::vector<std::complex<double> > > & codes)
+    {
+        int length = 0;
+        for(int c = 0; c < codes.size(); c++) length = std::max(length, (int)codes[c].size());
+        return length;
+    }
+
+    /*!
+     * The ring is counted once even though it is mapped twice.
+     */
+    size_t underlay_canceller::buffer_footprint()
+    {
+        return block::buffer_footprint() + m_pending_memory.size();
+    }
+
+    /*!
+     * The input is appended to the pending samples and every decision posted so far whose
+     * period has been fully received is subtracted from them. The decoder may run ahead of
+     * this block (e.g. in a pipelined chain), so the other decisions wait until the end of
+     * their period arrives. The receiver chain waits for the decoder to finish a chunk
+     * before handing out the next one, so every period starting before the decoder's last
+     * window of the previous chunk has been posted by now. The samples before that window
+     * can no longer be touched by a future decision so they are output. Only relying on the
+     * previous chunk also keeps the output size independent of how far along the decoder is
+     * with the current chunk.
+     *
+     * The tags of the input are held back with their samples.
+     *
+     * The input is copied behind the pending samples in the ring and the output is copied
+     * from its front, the pending samples themselves never move.
+     */
+    void underlay_canceller::work()
+    {
+        output_tags.resize(0);
+        if(input_buffer.size() == 0)
+        {
+            output_buffer.resize(0);
+            return;
+        }
+
+        int64_t decided = m_received - m_max_length - 1;
+        for(int t = 0; t < input_tags.size(); t++)
+        {
+            m_pending_tags.push_back(input_tags[t]);
+            m_pending_tags.back().offset += m_received;
+        }
+        m_received += input_buffer.size();
+        assert(m_pending_count + input_buffer.size() <= m_pending_capacity);
+        memcpy(m_pending + (m_pending_first + m_pending_count) % m_pending_capacity,
+               &input_buffer[0],
+               input_buffer.size() * sizeof(std::complex<double>));
+        m_pending_count += input_buffer.size();
+
+        underlay_decision decision;
+        while(m_decisions.pop(decision)) m_waiting.push_back(decision);
+
+        // Periods that are not fully received yet are kept for a later call
+        int waiting = 0;
+        for(int x = 0; x < m_waiting.size(); x++)
+        {
+            if(m_waiting[x].start + (int64_t)m_codes[m_waiting[x].code].size() <= m_received) cancel(m_waiting[x]);
+            else m_waiting[waiting++] = m_waiting[x];
+        }
+        m_waiting.resize(waiting);
+
+        int64_t out_size = std::min(decided - m_pending_start, (int64_t)m_pending_count);
+        if(out_size <= 0)
+        {
+            output_buffer.resize(0);
+            return;
+        }
+
+        output_buffer.resize(out_size);
+        memcpy(&output_buffer[0],
+               m_pending + m_pending_first,
+               out_size * sizeof(std::complex<double>));
+        m_pending_first = (m_pending_first + out_size) % m_pending_capacity;
+        m_pending_count -= out_size;
+
+        while(m_pending_tag_first < m_pending_tags.size() &&
+              (int64_t)m_pending_tags[m_pending_tag_first].offset < m_pending_start + out_size)
+        {
+            output_tags.push_back(m_pending_tags[m_pending_tag_first]);
+            output_tags.back().offset -= m_pending_start;
+            m_pending_tag_first++;
+        }
+
+        // The tags that went out are only dropped once they make up half of the list
+        if(m_pending_tag_first * 2 >= m_pending_tags.size())
+        {
+            m_pending_tags.erase(m_pending_tags.begin(), m_pending_tags.begin() + m_pending_tag_first);
+            m_pending_tag_first = 0;
+        }
+        m_pending_start += out_size;
+    }
+
+    void underlay_canceller::post(const underlay_decision & decision)
+    {
+        if(!m_decisions.push(decision)) m_dropped++;
+    }
+
+    /*!
+     * Only the part of the period that is still pending is cancelled. The part before it
+     * has already been output (which only happens for the zeros before the first sample).
+     */
+    void underlay_canceller::cancel(const underlay_decision & decision)
+    {
+        const std::vector<std::complex<double> > & pn = m_codes[decision.code];
+        int64_t offset = decision.start - m_pending_start;
+        int first = std::max((int64_t)0, -offset);
+        int last = std::min((int64_t)pn.size(), (int64_t)m_pending_count - offset);
+        for(int k = first; k < last; k++)
+        {
+            m_pending[m_pending_first + offset + k] -= decision.amplitude * pn[k];
+        }
+        m_cancelled++;
+    }
+}
@@ -0,0 +1,115 @@
+/*! \file underlay_canceller.h
+ *  \brief Header file for the Underlay Canceller block.
+ *
+ *  The underlay canceller block removes the underlay PN sequences found by the
+ *  underlay_decode block from the samples before they reach the frame_detector
+ *  (successive interference cancellation).
+ */
+
+#ifndef UNDERLAY_CANCELLER_H
+#define UNDERLAY_CANCELLER_H
+
+#include <atomic>
+#include <complex>
+#include <stdint.h>
+
+#include "block.h"
+#include "mirrored_ring.h"
+#include "spsc_queue.h"
+
+namespace wno
+{
+    /*!
+     * \brief A detected PN period to cancel
+     */
+    struct underlay_decision
+    {
+        int64_t start;                     //!< Absolute index of the first sample of the PN period
+        int code;                          //!< Index of the PN code
+        std::complex<double> amplitude;    //!< Estimated complex amplitude (polarity, gain and phase) of the period
+    };
+
+    /*!
+     * \brief The underlay_canceller block.
+     *
+     * Inputs complex doubles from the USRP block.
+     * Outputs the same complex doubles (delayed) with the detected underlay removed to the
+     * frame_detector block.
+     *
+     * The underlay_decode block taps the input of this block and posts a decision for each
+     * PN period it detects. The decoder runs concurrently with this block, so when this block
+     * processes a chunk the decoder is only known to have finished the previous chunk, in which
+     * it decided on every period except those whose windows end in its last sample. The samples
+     * are held back until they are past all the undecided periods. The delay is therefore one
+     * chunk plus one PN period.
+     *
+     * The held back samples live in a ring of mirrored memory, so they are always contiguous
+     * and outputting the oldest ones does not move the others.
+     */
+    class underlay_canceller : public wno::block<std::complex<double>, std::complex<double> >
+    {
+    public:
+
+        /*!
+         * \brief Constructor for underlay_canceller block.
+         * \param codes The PN sequences the decisions refer to.
+         * \param max_input Most samples per call to work().
+         */
+        underlay_canceller(const std::vector<std::vector<std::complex<double> > > & codes, size_t max_input = BUFFER_MAX);
+
+        virtual void work(); //!< Signal processing happens here.
+
+        virtual size_t buffer_footprint(); //!< Gets the bytes of the buffers including the pending samples
+
+        /*!
+         * \brief Posts a detected PN period to cancel. Called from the underlay_decode thread.
+         * \param decision The period to cancel.
+         */
+        void post(const underlay_decision & decision);
+
+        uint64_t periods_cancelled() { return m_cancelled; } //!< Get the number of PN periods cancelled so far
+
+        uint64_t decisions_dropped() { return m_dropped; } //!< Get the number of decisions lost to a full queue
+
+    private:
+
+        /*!
+         * \brief Subtracts one PN period from the pending samples.
+         */
+        void cancel(const underlay_decision & decision);
+
+        static int max_length(const std::vector<std::vector<std::complex<double> > > & codes); //!< Length of the longest of the codes
+
+        std::vector<std::vector<std::complex<double> > > m_codes; //!< The PN sequences
+
+        spsc_queue<underlay_decision> m_decisions; //!< Decisions posted by the underlay_decode thread
+
+        std::vector<underlay_decision> m_waiting; //!< Decisions whose period has not been fully received yet
+
+        int m_max_length; //!< Length of the longest PN sequence
+
+        int64_t m_received; //!< Number of samples received before the current input
+
+        mirrored_memory m_pending_memory; //!< Ring of the samples received but not output yet
+
+        std::complex<double> * m_pending; //!< Start of the ring (mapped twice, so the pending samples never wrap)
+
+        size_t m_pending_capacity; //!< Number of samples the ring holds
+
+        size_t m_pending_first; //!< Ring index of the oldest pending sample
+
+        size_t m_pending_count; //!< Number of pending samples
+
+        int64_t m_pending_start; //!< Absolute index of the oldest pending sample
+
+        std::vector<stream_tag> m_pending_tags; //!< Tags of the pending samples, by absolute index
+
+        size_t m_pending_tag_first; //!< Index of the oldest tag in #m_pending_tags that has not gone out yet
+
+        uint64_t m_cancelled; //!< Number of PN periods cancelled
+
+        std::atomic<uint64_t> m_dropped; //!< Number of decisions lost to a full queue
+    };
+}
+
+#endif // UNDERLAY_CANCELLER_H
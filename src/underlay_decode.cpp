@@ -1,9 +1,9 @@
 /*! \file underlay_decode.cpp
- *  \brief C++ file for the Timing Sync block.
+ *  \brief C++ file for the Underlay Decode block.
  *
- *  This block is in charge of using the two LTS symbols to align the received frame in time.
- *  It also uses the two LTS symbols to perform an initial frequency offset estimation and
- *  applying the necessary correction.
+ *  This block is in charge of finding the PN sequences that the transmitters add
+ *  underneath the OFDM frames and recovering the underlay bits carried by the
+ *  polarity of each PN period.
  */
 
 
@@ -11,164 +11,547 @@
 
 #include <algorithm>
 #include <cstring>
-#include <iostream>
-#include <fstream>
-#include <iomanip>
 
 #include "preamble.h"
-#include "underlay.h"
+#include "pn_sequence.h"
 #define COEFFTHRESH 0.1
 #define UPCOEFFTHRESH 0.15
-#define SEARCHWINDOW 50
-#define CARRYOVER_LENGTH pnSize
+#define LOCK_LOSS_MISSES 2
+#define MIN_SEGMENT_LENGTH 1024
+#define CORR_FFT_LENGTH 4096
+#define SIGN_CANDIDATE_THRESH (0.8 * COEFFTHRESH)
+#define AMPLITUDE_AVERAGING 16
+#define EVENT_QUEUE_SIZE 4096
 namespace wno
 {
     /*!
      * - Initializations:
+     *   + #pn_mean & #sqrt_n -> constants used by #normalize()
+     *   + #bits -> the code packed 64 chips per word for the fast search
+     *   + #stats -> statistics of a window of zeros (matches the zeroed input history)
+     *   + #state -> #ACQUISITION
      */
-    underlay_decode::underlay_decode() :
-        block("underlay_decode"),
-        m_carryover(CARRYOVER_LENGTH, 0)
-    {}
+    underlay_decode::pn_code::pn_code(const std::vector<std::complex<double> > & _pn, int _offset) :
+        pn(_pn),
+        offset(_offset),
+        pn_mean(0.0),
+        sqrt_n(sqrt(double(_pn.size()))),
+        bits((_pn.size() + 63) / 64, 0),
+        coeff_begin(0),
+        stats(_pn.size()),
+        stats_valid(true),
+        last_coeff(0.0),
+        state(ACQUISITION),
+        next_peak(0),
+        misses(0),
+        prev_bit(0),
+        bits_in_error(0),
+        bits_received(0),
+        amplitude(0, 0),
+        amplitude_periods(0)
+    {
+        for (int y=0; y<pn.size(); y++) pn_mean += pn[y].real();
+        pn_mean /= pn.size();
+
+        for (int y=0; y<pn.size(); y++)
+        {
+            if (pn[y].real() < 0) bits[y / 64] |= uint64_t(1) << (y % 64);
+        }
+    }
+
+    underlay_decode::underlay_decode(int num_workers, bool fast_search, int pn_length, size_t max_input) :
+        underlay_decode(std::vector<std::vector<std::complex<double> > >(1, pn_sequence(pn_length).chips()),
+                        num_workers, fast_search, max_input)
+    {
+    }
+
+    /*!
+     * - Initializations:
+     *   + #m_codes -> the codes, each offset so that all their windows end on the same sample
+     *   + history -> the longest code's length plus one samples (one PN period plus the early window, zeros at first)
+     *   + #m_pool -> none yet, the num_workers acquisition threads are only started by the
+     *     first search without a shared pool (see #set_pool())
+     *   + #m_segments -> one overlap-save correlator against all codes per thread
+     *   + #m_events -> room for #EVENT_QUEUE_SIZE events
+     *   + #m_search_codes -> room for every code
+     *   + #m_pack_re, #m_pack_im, #m_sign_re, #m_sign_im -> room for the sign bits of max_input
+     *     windows (fast search only)
+     *
+     * The segments' correlators see every code zero-padded at the front to the length of the
+     * longest one so that all codes are correlated against the same input windows.
+     */
+    underlay_decode::underlay_decode(const std::vector<std::vector<std::complex<double> > > & codes, int num_workers, bool fast_search,
+                                     size_t max_input) :
+        tap("underlay_decode", max_input, max_length(codes) + 1),
+        m_max_length(max_length(codes)),
+        m_num_workers(num_workers),
+        m_pool(NULL),
+        m_shared_pool(NULL),
+        m_fast_search(fast_search),
+        m_sign_stride(0),
+        m_canceller(NULL),
+        m_consumed(0),
+        m_events(EVENT_QUEUE_SIZE),
+        m_events_dropped(0)
+    {
+        for(int c = 0; c < codes.size(); c++) m_codes.push_back(pn_code(codes[c], m_max_length - codes[c].size()));
+        m_search_codes.reserve(codes.size());
+
+        add_segments(num_workers + 1);
+
+        if(fast_search)
+        {
+            int words = (max_input + m_max_length - 1 + 63) / 64 + 1;
+            m_pack_re.reserve(words);
+            m_pack_im.reserve(words);
+            m_sign_re.reserve(64 * (words - 1));
+            m_sign_im.reserve(64 * (words - 1));
+        }
+    }
+
+    void underlay_decode::add_segments(int count)
+    {
+        if(m_segments.size() >= count) return;
+
+        std::vector<std::vector<std::complex<double> > > padded(m_codes.size(), std::vector<std::complex<double> >(m_max_length, 0));
+        std::vector<int> lengths(m_codes.size());
+        for(int c = 0; c < m_codes.size(); c++)
+        {
+            std::copy(m_codes[c].pn.begin(), m_codes[c].pn.end(), padded[c].begin() + m_codes[c].offset);
+            lengths[c] = m_codes[c].pn.size();
+        }
+
+        int fft_length = CORR_FFT_LENGTH;
+        while(fft_length < 2 * m_max_length) fft_length *= 2;
+        while(m_segments.size() < count) m_segments.push_back(new acq_segment(padded, lengths, fft_length));
+    }
+
+    /*!
+     * The search is split into one segment per worker of the shared pool plus the
+     * thread running the block, idle workers pick up the segments while busy ones
+     * leave them to the others.
+     */
+    void underlay_decode::set_pool(work_stealing_pool * pool)
+    {
+        m_shared_pool = pool;
+        if(pool) add_segments(pool->size() + 1);
+    }
+
+    int underlay_decode::max_length(const std::vector<std::vector<std::complex<double> > > & codes)
+    {
+        int length = 0;
+        for(int c = 0; c < codes.size(); c++) length = std::max(length, (int)codes[c].size());
+        return length;
+    }
+
+    underlay_decode::~underlay_decode()
+    {
+        for(int x = 0; x < m_segments.size(); x++) delete m_segments[x];
+        delete m_pool;
+    }
+
+    std::vector<std::vector<std::complex<double> > > underlay_decode::codes()
+    {
+        std::vector<std::vector<std::complex<double> > > codes;
+        for(int c = 0; c < m_codes.size(); c++) codes.push_back(m_codes[c].pn);
+        return codes;
+    }
 
 
     /*!
+     * The #input_window holds the history in front of the input so that every window
+     * starting in this input is contiguous in memory. Window x of the longest code starts at input sample x minus
+     * its length, i.e. the windows owned by this call are the ones that end within it.
+     * The window before window 0 is kept around as well so that tracking can always look
+     * one sample early.
+     *
+     * The codes that are acquiring at the start of the input are searched together so that
+     * they share the input FFTs. Each code then consumes the input on its own by alternating
+     * between #acquire() and #track() depending on its mode. A code that loses its lock part
+     * way through the input is searched from that point on its own. A peak predicted past
+     * the end of this input is carried over to the next call.
      */
     void underlay_decode::work()
     {
-        double corr_coeff = 0.0;
-        if(input_buffer.size() == 0) return;
-        output_buffer.resize(input_buffer.size());
-        std::vector<std::complex<double> > input(input_buffer.size() + CARRYOVER_LENGTH);
-        std::ofstream myfile;
-        // myfile.open("corr.txt",std::fstream::app);
-
-        memcpy(&input[0],
-                &m_carryover[0],
-                CARRYOVER_LENGTH*sizeof(std::complex<double>));
-
-        memcpy(&input[CARRYOVER_LENGTH],
-                &input_buffer[0],
-                input_buffer.size() * sizeof(std::complex<double>));
-
-        // Step through the samples
-        // std::cout << "Input buffer size : " << input_buffer.size() << std::endl;
-        int in_size = input_buffer.size();
-        int next_x = 0;
-        int conf = prev_conf;
-        for(int x = 0; x < input_buffer.size(); x++)
-        {
-            // output_buffer[x].tag = NONE;
-            std::vector<std::complex<double> >::const_iterator first = input.begin() + x;
-            std::vector<std::complex<double> >::const_iterator last = input.begin() + x + pnSize-1;
-            std::vector<std::complex<double> > newVec(first, last);
-            if (x==next_x)
-            {
-                conf--;
-                // std::cout<< conf  << "*"<< x<< "*"<< next_x << std::endl;
-                corr_coeff = correlate(newVec);
-                next_x = (x+1)%in_size;
-            }
-            else
-            {
-                continue;
-            }
-            // myfile << std::fixed << std::setprecision(8) << corr_coeff << std::endl;
-            if(corr_coeff>COEFFTHRESH || corr_coeff<0-COEFFTHRESH)
+        if(input_buffer->size() == 0) return;
+        int in_size = input_buffer->size();
+
+        // base[x] is the first sample of window x of the longest code, base[-1] is valid
+        const std::complex<double> * base = &input_window[1];
+
+        m_search_codes.resize(0);
+        for(int c = 0; c < m_codes.size(); c++)
+        {
+            m_codes[c].coeff_begin = in_size;
+            if(m_codes[c].state == ACQUISITION) m_search_codes.push_back(c);
+        }
+        if(!m_search_codes.empty()) search(base, m_search_codes, 0, in_size);
+
+        for(int c = 0; c < m_codes.size(); c++)
+        {
+            pn_code & code = m_codes[c];
+            int x = 0;
+            while(x < in_size)
             {
-                if (corr_coeff>0) // bit '1' received
+                if(code.state == ACQUISITION)
                 {
-                    if (prev_bit == 1) bits_in_error++;
-                    prev_bit = 1;
+                    if(x < code.coeff_begin)
+                    {
+                        m_search_codes.assign(1, c);
+                        search(base, m_search_codes, x, in_size);
+                    }
+                    x = acquire(c, base, x, in_size);
                 }
-                else if (corr_coeff<0) // bit '0' received
+                else
                 {
-                    if (prev_bit == 0) bits_in_error++;
-                    prev_bit = 0;
+                    // The late window of the predicted peak must end within this input
+                    if(code.next_peak + 1 > in_size) break;
+                    x = track(c, base);
                 }
+            }
+
+            if(code.state == TRACKING)
+            {
+                code.next_peak -= in_size;
+                code.stats_valid = false;
+            }
+        }
+
+        m_consumed += in_size;
+    }
+
+    /*!
+     * The windows are split into contiguous segments which are correlated in parallel.
+     * Each segment transforms its windows once with its own overlap-save correlator and
+     * multiplies the transform by the spectrum of each code. The correlations are normalized
+     * with the segment's running statistics of each code, which are primed directly from
+     * the samples unless the segment continues where the previous call left off.
+     */
+    void underlay_decode::search(const std::complex<double> * base, const std::vector<int> & codes, int begin, int end)
+    {
+        int count = end - begin;
+        int num_segments = std::min((int)m_segments.size(), (count + MIN_SEGMENT_LENGTH - 1) / MIN_SEGMENT_LENGTH);
+        int segment_length = (count + num_segments - 1) / num_segments;
+        for(int i = 0; i < codes.size(); i++)
+        {
+            m_codes[codes[i]].coeff.resize(end);
+            m_codes[codes[i]].coeff_begin = begin;
+        }
+
+        if(m_fast_search) pack_signs(&base[begin], count + m_max_length - 1);
+
+        std::function<void(int)> run_segment = [&](int s)
+        {
+            acq_segment * segment = m_segments[s];
+            int first = begin + s * segment_length;
+            int last = std::min(first + segment_length, end);
+            if(first >= last) return;
 
-                if(corr_coeff>UPCOEFFTHRESH || corr_coeff< 0 - UPCOEFFTHRESH) // very high correlation received
+            if(m_fast_search)
+            {
+                for(int i = 0; i < codes.size(); i++)
                 {
-                    conf = 100; // increase confidance to max
+                    pn_code & code = m_codes[codes[i]];
+                    for(int w = first; w < last; w++)
+                    {
+                        if(sign_correlate(code, w - begin + code.offset) > SIGN_CANDIDATE_THRESH) code.coeff[w] = correlate(code, &base[w + code.offset]);
+                        else code.coeff[w] = 0.0;
+                    }
                 }
-                else 
+                return;
+            }
+
+            for(int i = 0; i < codes.size(); i++)
+            {
+                segment->corr[i].resize(last - first);
+                segment->outputs[i] = &segment->corr[i][0];
+            }
+            segment->correlator.correlate(&base[first], last - first, codes, &segment->outputs[0]);
+
+            for(int i = 0; i < codes.size(); i++)
+            {
+                pn_code & code = m_codes[codes[i]];
+                window_stats & stats = segment->stats[codes[i]];
+                if(s == 0 && begin == 0 && code.stats_valid) stats = code.stats;
+                else stats.reset(&base[first + code.offset]);
+
+                for(int w = first; w < last; w++)
                 {
-                    if (conf > 0) conf = 100; // peak detected in expected zone
+                    code.coeff[w] = normalize(code, segment->corr[i][w - first], stats);
+                    stats.slide(&base[w + code.offset]);
                 }
+            }
+        };
 
-                if (conf < 100)
-                    next_x = (x+1)%in_size;
-                else
-                    next_x = (x+pnSize-SEARCHWINDOW)%in_size; // go to 50 samples behind expected peak
+        if(m_shared_pool) m_shared_pool->parallel_for(num_segments, run_segment);
+        else
+        {
+            if(!m_pool) m_pool = new thread_pool(m_num_workers);
+            m_pool->parallel_for(num_segments, run_segment);
+        }
 
-                std::cout <<  x << " " << corr_coeff << " " << bits_in_error  << " " << next_x<< " " << prev_bit << std::endl;
+        // The last segment's statistics now describe window 0 of the next call
+        // (the fast search does not keep running statistics)
+        for(int i = 0; i < codes.size(); i++)
+        {
+            pn_code & code = m_codes[codes[i]];
+            code.stats = m_segments[num_segments - 1]->stats[codes[i]];
+            if((num_segments - 1) * segment_length >= count) code.stats.reset(&base[end + code.offset]);
+            code.stats_valid = !m_fast_search;
+        }
+    }
+
+    /*!
+     * The normalized correlations are scanned in order for local peaks above COEFFTHRESH.
+     * The first one above UPCOEFFTHRESH declares lock.
+     */
+    int underlay_decode::acquire(int c, const std::complex<double> * base, int begin, int end)
+    {
+        pn_code & code = m_codes[c];
+        double prev_coeff = (begin == 0) ? code.last_coeff : 0.0;
+        code.last_coeff = code.coeff[end - 1];
+
+        for(int w = begin; w < end; w++)
+        {
+            double mag = std::abs(code.coeff[w]);
+            double next_mag = (w + 1 < end) ? std::abs(code.coeff[w + 1]) : 0.0;
+            double prev_mag = (w > begin) ? std::abs(code.coeff[w - 1]) : std::abs(prev_coeff);
+            if(mag <= COEFFTHRESH || mag < prev_mag || mag <= next_mag) continue;
+
+            if(mag > UPCOEFFTHRESH) // very high correlation received
+            {
+                code.state = TRACKING;
+                code.next_peak = w + code.pn.size();
+                code.misses = 0;
+                code.amplitude_periods = 0;
+                report(c, w, code.coeff[w]);
+
+                std::complex<double> amplitude;
+                correlate(code, &base[w + code.offset], &amplitude);
+                post(c, w, amplitude);
+                return w + 1;
+            }
+
+            report(c, w, code.coeff[w]);
+        }
+
+        return end;
+    }
+
+    /*!
+     * The early, on-time and late windows are correlated directly which costs 3 * pn length
+     * multiply-adds per PN period instead of a correlation at every offset. The strongest
+     * of the three becomes the new estimate of the peak, which lets the tracker follow
+     * a slow drift between the transmitter and receiver sample clocks.
+     */
+    int underlay_decode::track(int c, const std::complex<double> * base)
+    {
+        pn_code & code = m_codes[c];
+        int peak = code.next_peak;
+        int best = peak;
+        code.stats_valid = false;
+        double best_coeff = 0.0;
+        std::complex<double> best_amplitude;
+        for(int w = peak - 1; w <= peak + 1; w++)
+        {
+            std::complex<double> amplitude;
+            double corr_coeff = correlate(code, &base[w + code.offset], &amplitude);
+            if(std::abs(corr_coeff) > std::abs(best_coeff))
+            {
+                best_coeff = corr_coeff;
+                best_amplitude = amplitude;
+                best = w;
             }
+        }
+
+        if(std::abs(best_coeff) > COEFFTHRESH) // peak detected in expected zone
+        {
+            code.misses = 0;
+            code.next_peak = best + code.pn.size();
+            report(c, best, best_coeff);
+            post(c, best, best_amplitude);
+            return best + 1;
+        }
+
+        // Coast through a missed period before giving up on the lock
+        if(++code.misses < LOCK_LOSS_MISSES)
+        {
+            code.next_peak = peak + code.pn.size();
+            return peak + 2;
+        }
+
+        code.state = ACQUISITION;
+        code.last_coeff = 0.0;
+        return peak + 2;
+    }
+
+    /*!
+     * The transmitter alternates the polarity of each PN period, so two consecutive
+     * bits with the same polarity are counted as a bit error.
+     */
+    void underlay_decode::report(int c, int x, double corr_coeff)
+    {
+        pn_code & code = m_codes[c];
+        if (corr_coeff>0) // bit '1' received
+        {
+            if (code.prev_bit == 1) code.bits_in_error++;
+            code.prev_bit = 1;
+        }
+        else if (corr_coeff<0) // bit '0' received
+        {
+            if (code.prev_bit == 0) code.bits_in_error++;
+            code.prev_bit = 0;
+        }
+
+        code.bits_received++;
 
-            // if (correlate(newVec))
-            // {
-            //     // std::cout << "PN seq found at " << x << std::endl;
-            //     // output_buffer[x].tag = ULPN;
-            // }
-            // else
-            // {
-            //     //
-            // }
-        }
-        prev_conf = conf;
-        // myfile.close();
-        memcpy(&output_buffer[0],
-                &input[0],
-                input_buffer.size() * sizeof(std::complex<double>));
-                //input_buffer.size() * sizeof(tagged_sample));
-        memcpy(&m_carryover[0],
-                &input[input_buffer.size()],
-                CARRYOVER_LENGTH * sizeof(std::complex<double>));
+        underlay_event event;
+        event.index = m_consumed - m_max_length + x + code.offset;
+        event.code = c;
+        event.coeff = corr_coeff;
+        event.bit = code.prev_bit;
+        event.locked = (code.state == TRACKING);
+        event.bits = code.bits_received;
+        event.bits_in_error = code.bits_in_error;
+        event.ber = double(code.bits_in_error) / code.bits_received;
+        if(!m_events.push(event)) m_events_dropped++;
     }
 
     /*!
-     *  correlates with SPNS and returns 'true' when correlation exceeds the threshold
+     * The polarity of the period is decided against the averaged amplitude, the period's
+     * amplitude is then folded into the average (a running mean over the first
+     * AMPLITUDE_AVERAGING periods and an exponential average after that) and the averaged
+     * amplitude with the period's polarity is posted.
      */
-    double underlay_decode::correlate(std::vector<std::complex<double> > samples)
-    {
-        std::complex<double> temp_mul;
-        std::complex<double> temp_mean;
-        double temp_norm_v;
-        double corr_coeff = 0.0;
-        double sqr_sum = 0.0;
-        temp_mul = (0.0, 0.0);
-        temp_mean = (0.0, 0.0);
-        sqr_sum = 0.0;
-
-        int N = pnSize;
-        std::complex<double> cplx_numr;
-        double numr;
-        double denm;
-        double pn_mean = 0.0;
-        for (int y=0; y<N; y++)
-        {
-            pn_mean += SPNS[y].real();
-        }
-        pn_mean/=N;
-        for (int y=0; y<N; y++)
-        {
-            temp_mul += samples[y] * SPNS[y];
-            sqr_sum += pow(abs(samples[y]),2);
-            temp_mean += samples[y];
-        }
-        temp_mean/=N;
-        temp_norm_v = 0.0;
-        std::complex<double> scaled_temp_mean = N*pn_mean*temp_mean;
-        cplx_numr = (temp_mul-scaled_temp_mean);
-        numr = abs(temp_mul-scaled_temp_mean);
-        denm = sqrt(sqr_sum-N*pow(abs(temp_mean),2))*sqrt(N);
-        if (denm == 0) // Is it the right way to do it ??
+    void underlay_decode::post(int c, int x, std::complex<double> amplitude)
+    {
+        if(!m_canceller) return;
+
+        pn_code & code = m_codes[c];
+        double polarity;
+        if(code.amplitude_periods == 0) polarity = (amplitude.real() > 0) ? 1 : -1;
+        else polarity = ((amplitude * std::conj(code.amplitude)).real() > 0) ? 1 : -1;
+
+        if(code.amplitude_periods < AMPLITUDE_AVERAGING) code.amplitude_periods++;
+        code.amplitude += (polarity * amplitude - code.amplitude) / double(code.amplitude_periods);
+
+        underlay_decision decision;
+        decision.start = m_consumed - m_max_length + x + code.offset;
+        decision.code = c;
+        decision.amplitude = polarity * code.amplitude;
+        m_canceller->post(decision);
+    }
+
+    /*!
+     * The sign bits are stored 64 times, once shifted by each bit offset, so that the words
+     * of any window are aligned and #sign_correlate() does not need to shift them itself.
+     * They are first packed unshifted into #m_pack_re and #m_pack_im, which like the rows
+     * were sized for max_input windows by the constructor.
+     */
+    void underlay_decode::pack_signs(const std::complex<double> * samples, int count)
+    {
+        // One spare word so that the last shifted word can always read its neighbour
+        int words = (count + 63) / 64 + 1;
+        m_pack_re.assign(words, 0);
+        m_pack_im.assign(words, 0);
+        uint64_t * re = &m_pack_re[0];
+        uint64_t * im = &m_pack_im[0];
+        for(int x = 0; x < count; x++)
+        {
+            uint64_t bit = uint64_t(1) << (x % 64);
+            if(samples[x].real() < 0) re[x / 64] |= bit;
+            if(samples[x].imag() < 0) im[x / 64] |= bit;
+        }
+
+        m_sign_stride = words - 1;
+        m_sign_re.resize(64 * m_sign_stride);
+        m_sign_im.resize(64 * m_sign_stride);
+        for(int w = 0; w < m_sign_stride; w++)
+        {
+            m_sign_re[w] = re[w];
+            m_sign_im[w] = im[w];
+        }
+        for(int shift = 1; shift < 64; shift++)
+        {
+            uint64_t * re_row = &m_sign_re[shift * m_sign_stride];
+            uint64_t * im_row = &m_sign_im[shift * m_sign_stride];
+            for(int w = 0; w < m_sign_stride; w++)
+            {
+                re_row[w] = (re[w] >> shift) | (re[w + 1] << (64 - shift));
+                im_row[w] = (im[w] >> shift) | (im[w + 1] << (64 - shift));
+            }
+        }
+    }
+
+    /*!
+     * Two chips agree when their sign bits match, so the correlation of 64 chips is
+     * 64 - 2 * popcount(samples XOR pn). The real and imaginary parts are correlated
+     * separately since the carrier phase of the underlay is unknown. The chips past the
+     * end of a code whose length is not a multiple of 64 are masked out.
+     */
+    double underlay_decode::sign_correlate(const pn_code & code, int offset)
+    {
+        int row = (offset % 64) * m_sign_stride + offset / 64;
+        const uint64_t * re = &m_sign_re[row];
+        const uint64_t * im = &m_sign_im[row];
+        int length = code.pn.size();
+        int full_words = length / 64;
+        int disagree_re = 0;
+        int disagree_im = 0;
+        for(int w = 0; w < full_words; w++)
+        {
+            disagree_re += __builtin_popcountll(re[w] ^ code.bits[w]);
+            disagree_im += __builtin_popcountll(im[w] ^ code.bits[w]);
+        }
+        if(length % 64)
+        {
+            uint64_t mask = (uint64_t(1) << (length % 64)) - 1;
+            disagree_re += __builtin_popcountll((re[full_words] ^ code.bits[full_words]) & mask);
+            disagree_im += __builtin_popcountll((im[full_words] ^ code.bits[full_words]) & mask);
+        }
+        double corr_re = length - 2 * disagree_re;
+        double corr_im = length - 2 * disagree_im;
+        return sqrt(corr_re * corr_re + corr_im * corr_im) / length;
+    }
+
+    /*!
+     *  Correlates the samples of one window starting at samples[0] with the code and
+     *  returns the normalized correlation coefficient.
+     */
+    double underlay_decode::correlate(const pn_code & code, const std::complex<double> * samples, std::complex<double> * amplitude)
+    {
+        std::complex<double> temp_mul(0.0, 0.0);
+        for (int y=0; y<code.pn.size(); y++)
+        {
+            temp_mul += samples[y] * code.pn[y];
+        }
+        window_stats stats(code.pn.size());
+        stats.reset(samples);
+        return normalize(code, temp_mul, stats, amplitude);
+    }
+
+    /*!
+     *  Normalizes the correlation temp_mul of a window with the code using the window's running
+     *  statistics. The sign of the returned coefficient follows the sign of the real part
+     *  of the mean-removed correlation.
+     *
+     *  The mean-removed correlation is also the numerator of the least squares estimate of
+     *  the amplitude a in window = a * pn + dc, whose denominator is the energy of the
+     *  mean-removed code N * (1 - pn_mean^2).
+     */
+    double underlay_decode::normalize(const pn_code & code, std::complex<double> temp_mul, const window_stats & stats, std::complex<double> * amplitude)
+    {
+        // N*pn_mean*temp_mean == pn_mean*sum
+        std::complex<double> cplx_numr = temp_mul - code.pn_mean*stats.sum;
+        if (amplitude) *amplitude = cplx_numr / (code.pn.size() * (1 - code.pn_mean*code.pn_mean));
+        double centered_power = stats.centered_power();
+        if (centered_power <= 0) // Is it the right way to do it ??
             return(0.00001);
+        double numr = abs(cplx_numr);
+        double denm = sqrt(centered_power)*code.sqrt_n;
         if (cplx_numr.real()>0)
-            corr_coeff = numr/denm;
+            return numr/denm;
         else
-            corr_coeff = 0.0-numr/denm;
-        // corr_coeff = numr/denm;
-        // corr_coeff = cplx_numr.real()/denm;
-        return(corr_coeff);
+            return 0.0-numr/denm;
     }
 }
@@ -1,37 +1,276 @@
 /*! \file underlay_decode.h
- *  \brief Hader file for the Timing Sync block.
+ *  \brief Header file for the Underlay Decode block.
  *
- *  The timing sync block is in charge of using the two LTS symbols to align the received frame in time.
- *  It also uses the two LTS symbols to perform an initial frequency offset estimation and
- *  applying the necessary correction.
+ *  The underlay decode block is in charge of finding the PN sequences that the
+ *  transmitters add underneath the OFDM frames and recovering the underlay bits
+ *  carried by the polarity of each PN period.
  */
 
 #ifndef UNDERLAY_DECODE_H
 #define UNDERLAY_DECODE_H
+#include <atomic>
 #include <complex>
+#include <stdint.h>
 
 #include "block.h"
 #include "tagged_vector.h"
+#include "pn_correlator.h"
+#include "pn_sequence.h"
+#include "window_stats.h"
+#include "thread_pool.h"
+#include "work_stealing_pool.h"
+#include "underlay_canceller.h"
+#include "spsc_queue.h"
 
 namespace wno
 {
+    /*!
+     * \brief An underlay bit detected by the underlay_decode block
+     */
+    struct underlay_event
+    {
+        int64_t index;          //!< Absolute index of the first sample of the PN period
+        int code;               //!< Index of the PN code
+        double coeff;           //!< Normalized correlation of the period (its sign is the polarity)
+        int bit;                //!< Decided underlay bit
+        bool locked;            //!< Whether the decoder is tracking the code after this period
+        uint64_t bits;          //!< Number of bits received on this code so far
+        uint64_t bits_in_error; //!< Number of bits received with the same polarity as the previous one so far
+        double ber;             //!< Running bit error rate (bits_in_error / bits)
+    };
+
     /*!
      * \brief The underlay_decode block.
+     *
+     * Inputs complex doubles from the USRP block. The block is a tap on the input of the
+     * frame_detector block, so it has no output and does not delay the overlay path.
+     *
+     * The block searches for a configurable set of PN codes at once (SPNS by default),
+     * for example one per transmitter or one per underlay bit stream. Each code is
+     * decoded independently and runs in one of two modes:
+     * - Acquisition: every window offset of the input is correlated with the code. The
+     *   search is split into segments that run in parallel on a thread_pool (or on a
+     *   shared work_stealing_pool), each segment using the overlap-save correlator and its own running window statistics.
+     *   All codes being acquired share the forward FFT of each input segment.
+     *   A correlation above UPCOEFFTHRESH declares lock. In fast search mode the samples
+     *   are instead quantized to their sign bits and correlated with the bit-packed code
+     *   64 chips at a time using XOR and popcount. Only the windows whose sign correlation
+     *   exceeds SIGN_CANDIDATE_THRESH are confirmed with the exact correlation.
+     * - Tracking: once locked, the next peak is expected one PN period later, so only
+     *   the early, on-time and late windows around the predicted peak are correlated,
+     *   once per period. A peak above COEFFTHRESH keeps the lock and re-centres the
+     *   prediction, otherwise the lock is lost after LOCK_LOSS_MISSES missed periods.
+     *
+     * Codes may have different lengths. Window x of every code ends on the same sample,
+     * i.e. window x of a code shorter than the longest one starts later in the input.
+     *
+     * If an underlay_canceller is attached, every locked PN period is posted to it with its
+     * estimated complex amplitude so that it can be subtracted before overlay decoding.
+     * The amplitude of a single period is too noisy for that (the overlay is much stronger
+     * than the underlay), so the amplitude is averaged over the periods since lock and only
+     * the polarity is decided per period.
+     *
+     * Every detected period is reported as an underlay_event through a lock-free queue
+     * which the thread using the block drains with #poll_event(). Events are dropped
+     * (and counted) when the queue is full so that the decoder never blocks on a slow
+     * consumer.
      */
-    class underlay_decode : public wno::block<std::complex<double>, std::complex<double> >
+    class underlay_decode : public wno::tap<std::complex<double> >
     {
     public:
 
-        underlay_decode(); //!< Constructor for underlay_decode block.
+        /*!
+         * \brief Constructor for underlay_decode block searching for SPNS.
+         * \param num_workers Number of worker threads used (in addition to the block's own
+         *  thread) for the acquisition search.
+         * \param fast_search Use the 1-bit sign correlator for the acquisition search instead
+         *  of the overlap-save correlator.
+         * \param pn_length Length of the SPNS sequence.
+         * \param max_input Most samples per call to work().
+         */
+        underlay_decode(int num_workers = 2, bool fast_search = false, int pn_length = DEFAULT_PN_LENGTH, size_t max_input = BUFFER_MAX);
+
+        /*!
+         * \brief Constructor for underlay_decode block searching for several codes.
+         * \param codes The PN sequences to search for. Each must be purely +/-1 real.
+         * \param num_workers Number of worker threads used (in addition to the block's own
+         *  thread) for the acquisition search.
+         * \param fast_search Use the 1-bit sign correlator for the acquisition search instead
+         *  of the overlap-save correlator.
+         * \param max_input Most samples per call to work().
+         */
+        underlay_decode(const std::vector<std::vector<std::complex<double> > > & codes, int num_workers = 2, bool fast_search = false,
+                        size_t max_input = BUFFER_MAX);
+
+        ~underlay_decode(); //!< Destructor for underlay_decode block.
 
         virtual void work(); //!< Signal processing happens here.
 
+        /*!
+         * \brief Attaches a canceller that the locked PN periods are posted to.
+         * \param canceller The canceller whose input this block taps.
+         */
+        void set_canceller(underlay_canceller * canceller) { m_canceller = canceller; }
+
+        /*!
+         * \brief Runs the acquisition search on a shared pool instead of the block's own workers,
+         *  which are then never started.
+         * \param pool The pool whose idle workers the search is split over.
+         */
+        void set_pool(work_stealing_pool * pool);
+
+        /*!
+         * \brief Get the PN sequences being searched for
+         */
+        std::vector<std::vector<std::complex<double> > > codes();
+
+        /*!
+         * \brief Gets the next underlay event. Only one thread may poll the events.
+         * \param event Set to the oldest event not polled yet.
+         * \return False if there was no event.
+         */
+        bool poll_event(underlay_event & event) { return m_events.pop(event); }
+
+        uint64_t events_dropped() { return m_events_dropped; } //!< Get the number of events lost to a full queue
+
     private:
-        double correlate(std::vector<std::complex<double> >);
-        int prev_bit = 0;
-        int prev_conf = 0;
-        int bits_in_error = 0;
-        std::vector<std::complex<double> > m_carryover;
+
+        /*!
+         * \brief Decoder mode
+         */
+        enum track_state
+        {
+            ACQUISITION, //!< Searching every offset for the PN sequence
+            TRACKING,    //!< Locked, only checking around the predicted peak
+        };
+
+        /*!
+         * \brief Constants and decoder state of one PN code
+         */
+        struct pn_code
+        {
+            std::vector<std::complex<double> > pn; //!< The PN sequence
+            int offset;                 //!< Start of window 0 relative to the start of window 0 of the longest code
+            double pn_mean;             //!< Mean of the PN sequence
+            double sqrt_n;              //!< Square root of the PN sequence length
+            std::vector<uint64_t> bits; //!< PN sequence packed one bit per chip (1 for -1)
+            std::vector<double> coeff;  //!< Normalized correlation of each window searched in the current input
+            int coeff_begin;            //!< First window of the current input for which #coeff is valid
+            window_stats stats;         //!< Running mean & power of window 0 of the next input
+            bool stats_valid;           //!< Whether #stats is in step (false after tracking)
+            double last_coeff;          //!< Correlation of the last window searched in the previous input
+            track_state state;          //!< Current mode
+            int next_peak;              //!< Predicted window of the next peak while tracking (relative to current input)
+            int misses;                 //!< Number of consecutive periods without a peak while tracking
+            int prev_bit;               //!< Last underlay bit received
+            int bits_in_error;          //!< Number of consecutive bits received with the same polarity
+            uint64_t bits_received;     //!< Number of bits received
+            std::complex<double> amplitude; //!< Averaged complex amplitude of the positive polarity since lock
+            int amplitude_periods;      //!< Number of periods averaged into #amplitude
+
+            pn_code(const std::vector<std::complex<double> > & _pn, int _offset);
+        };
+
+        /*!
+         * \brief Per segment state for the parallel acquisition search
+         */
+        struct acq_segment
+        {
+            pn_correlator correlator;                 //!< Overlap-save correlator against every code
+            std::vector<window_stats> stats;          //!< Running window statistics of the segment for each code
+            std::vector<std::vector<std::complex<double> > > corr; //!< Un-normalized correlations of the segment for each code
+            std::vector<std::complex<double> *> outputs; //!< Pointers to the entries of #corr in use, passed to the correlator
+
+            acq_segment(const std::vector<std::vector<std::complex<double> > > & padded_codes, const std::vector<int> & lengths, int fft_length) :
+                correlator(padded_codes, fft_length),
+                corr(padded_codes.size()),
+                outputs(padded_codes.size())
+            {
+                for(int c = 0; c < lengths.size(); c++) stats.push_back(window_stats(lengths[c]));
+            }
+        };
+
+        /*!
+         * \brief Computes the normalized correlations of windows [begin, end) for several codes.
+         * \param base Pointer to the first sample of window 0 of the longest code.
+         * \param codes Indices of the codes to correlate.
+         * \param begin First window to search.
+         * \param end One past the last window to search.
+         */
+        void search(const std::complex<double> * base, const std::vector<int> & codes, int begin, int end);
+
+        /*!
+         * \brief Scans the searched windows [begin, end) of a code for peaks.
+         * \param c Index of the code.
+         * \param base Pointer to the first sample of window 0 of the longest code.
+         * \param begin First window to scan.
+         * \param end One past the last window to scan.
+         * \return The window after the one where lock was declared or end if no lock was found.
+         */
+        int acquire(int c, const std::complex<double> * base, int begin, int end);
+
+        /*!
+         * \brief Correlates the early, on-time and late windows around the predicted peak of a code.
+         * \param c Index of the code.
+         * \param base Pointer to the first sample of window 0 of the longest code.
+         * \return The next window to search if the lock was lost.
+         */
+        int track(int c, const std::complex<double> * base);
+
+        /*!
+         * \brief Decides the underlay bit for a detected peak and queues an event for it.
+         * \param c Index of the code.
+         * \param x Window of the peak.
+         * \param corr_coeff Normalized correlation of the peak.
+         */
+        void report(int c, int x, double corr_coeff);
+
+        /*!
+         * \brief Posts a locked PN period to the canceller if there is one.
+         * \param c Index of the code.
+         * \param x Window of the period.
+         * \param amplitude Estimated complex amplitude of the period.
+         */
+        void post(int c, int x, std::complex<double> amplitude);
+
+        /*!
+         * \brief Packs the signs of the real and imaginary parts of count samples into
+         *  #m_sign_re and #m_sign_im, one bit per sample (1 for negative).
+         */
+        void pack_signs(const std::complex<double> * samples, int count);
+
+        /*!
+         * \brief Magnitude of the 1-bit correlation of the window starting at packed bit
+         *  offset with the bit-packed code, normalized to [0, 1].
+         */
+        double sign_correlate(const pn_code & code, int offset);
+
+        double correlate(const pn_code & code, const std::complex<double> * samples, std::complex<double> * amplitude = NULL); //!< Correlates a single window with a code
+        double normalize(const pn_code & code, std::complex<double> temp_mul, const window_stats & stats, std::complex<double> * amplitude = NULL); //!< Normalizes a window's correlation
+        std::vector<pn_code> m_codes; //!< The codes being searched for
+        std::vector<int> m_search_codes; //!< Indices of the codes passed to #search() (scratch of #work())
+        int m_max_length; //!< Length of the longest code
+        static int max_length(const std::vector<std::vector<std::complex<double> > > & codes); //!< Length of the longest of the codes
+        int m_num_workers; //!< Number of workers of #m_pool
+        thread_pool * m_pool; //!< Workers for the acquisition search (NULL until a search runs without #m_shared_pool)
+        work_stealing_pool * m_shared_pool; //!< Shared pool used for the acquisition search instead of #m_pool (NULL if none)
+        std::vector<acq_segment *> m_segments; //!< One acquisition segment per thread (pool + block thread)
+
+        /*!
+         * \brief Adds acquisition segments until there is one per thread.
+         * \param count Number of segments needed.
+         */
+        void add_segments(int count);
+        bool m_fast_search; //!< Whether to use the 1-bit sign correlator for acquisition
+        std::vector<uint64_t> m_pack_re; //!< Sign bits of the real part of the searched samples, unshifted (scratch of #pack_signs())
+        std::vector<uint64_t> m_pack_im; //!< Sign bits of the imaginary part of the searched samples, unshifted (scratch of #pack_signs())
+        std::vector<uint64_t> m_sign_re; //!< Sign bits of the real part of the searched samples, one row per bit shift
+        std::vector<uint64_t> m_sign_im; //!< Sign bits of the imaginary part of the searched samples, one row per bit shift
+        int m_sign_stride; //!< Number of words in each row of #m_sign_re and #m_sign_im
+        underlay_canceller * m_canceller; //!< Canceller the locked periods are posted to (NULL if none)
+        int64_t m_consumed; //!< Absolute index of the first sample of the current input
+        spsc_queue<underlay_event> m_events; //!< Detected underlay bits waiting to be polled
+        std::atomic<uint64_t> m_events_dropped; //!< Number of events lost to a full queue
     };
 }
 
@@ -122,11 +122,24 @@ namespace wno
      * for more details.
      *
      */
-    void usrp::get_samples(int num_samples, std::vector<std::complex<double> > & buffer)
+    size_t usrp::get_samples(int num_samples, std::vector<std::complex<double> > & buffer)
     {
         // Get some samples
         uhd::rx_metadata_t rx_meta;
-        m_rx_streamer->recv(&buffer[0], num_samples, rx_meta);
+        return m_rx_streamer->recv(&buffer[0], num_samples, rx_meta);
+    }
+
+    /*!
+     * On an overflow UHD returns early, usually without samples, and reports the time of the
+     * samples following the gap with the next call.
+     */
+    size_t usrp::get_samples(int num_samples, std::vector<std::complex<double> > & buffer, double & time, bool & overflow)
+    {
+        uhd::rx_metadata_t rx_meta;
+        size_t count = m_rx_streamer->recv(&buffer[0], num_samples, rx_meta);
+        time = rx_meta.has_time_spec ? rx_meta.time_spec.get_real_secs() : -1;
+        overflow = (rx_meta.error_code == uhd::rx_metadata_t::ERROR_CODE_OVERFLOW);
+        return count;
     }
 
 }
@@ -86,11 +86,27 @@ namespace wno
 
         // Get some samples from the USRP
         /*!
-         * \brief Gets num_samples samples and places them in the first num_samples of buffer.
+         * \brief Gets up to num_samples samples and places them in the first samples of buffer.
          * \param num_samples The number of samples to retrieve from USRP.
          * \param buffer The buffer to place the retrieved samples in.
+         * \return The number of samples received, fewer than num_samples on a timeout or error.
          */
-        void get_samples(int num_samples, std::vector<std::complex<double> > & buffer);
+        size_t get_samples(int num_samples, std::vector<std::complex<double> > & buffer);
+
+        /*!
+         * \brief Same as #get_samples() but also reports when the first sample was taken and
+         *  whether the device dropped samples.
+         * \param num_samples The number of samples to retrieve from USRP.
+         * \param buffer The buffer to place the retrieved samples in.
+         * \param time Set to the device time of the first sample in seconds, or -1 if the
+         *  device did not report one.
+         * \param overflow Set if the device reported an overflow, i.e. it dropped samples
+         *  because they were not retrieved fast enough.
+         * \return The number of samples received, fewer than num_samples on a timeout or error.
+         */
+        size_t get_samples(int num_samples, std::vector<std::complex<double> > & buffer, double & time, bool & overflow);
+
+        double get_rx_rate() { return m_usrp->get_rx_rate(); } //!< Get the sample rate the USRP actually receives at
 
 
     private:
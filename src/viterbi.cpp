@@ -174,8 +174,12 @@ namespace wno
 
       /* Decode block */
       //vp->update_blk(vp, symbols, nbits+(K-1));
+      m_renormalized = 0;
       viterbi_update_blk_SPIRAL(vp, symbols, nbits + (K-1));
 
+      /* The block ends in state 0, whose metric is still relative to the renormalizations */
+      m_path_metric = m_renormalized + vp->old_metrics->t[0];
+
       /* Do Viterbi chainback */
       viterbi_chainback(vp, data, nbits, 0);
     }
@@ -325,6 +329,7 @@ namespace wno
                 m7 = _mm_unpacklo_epi8(m7, m7);
                 m7 = _mm_shufflelo_epi16(m7, _MM_SHUFFLE(0, 0, 0, 0));
                 m6 = _mm_unpacklo_epi64(m7, m7);
+                m_renormalized += _mm_cvtsi128_si32(m6) & 0xFF;
                 ((__m128i  *) Y)[0] = _mm_subs_epu8(((__m128i  *) Y)[0], m6);
                 ((__m128i  *) Y)[1] = _mm_subs_epu8(((__m128i  *) Y)[1], m6);
                 ((__m128i  *) Y)[2] = _mm_subs_epu8(((__m128i  *) Y)[2], m6);
@@ -449,6 +454,7 @@ namespace wno
                 m14 = _mm_unpacklo_epi8(m14, m14);
                 m14 = _mm_shufflelo_epi16(m14, _MM_SHUFFLE(0, 0, 0, 0));
                 m13 = _mm_unpacklo_epi64(m14, m14);
+                m_renormalized += _mm_cvtsi128_si32(m13) & 0xFF;
                 ((__m128i  *) X)[0] = _mm_subs_epu8(((__m128i  *) X)[0], m13);
                 ((__m128i  *) X)[1] = _mm_subs_epu8(((__m128i  *) X)[1], m13);
                 ((__m128i  *) X)[2] = _mm_subs_epu8(((__m128i  *) X)[2], m13);
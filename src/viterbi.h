@@ -67,6 +67,10 @@ namespace wno
 
         COMPUTETYPE Branchtab[NUMSTATES/2*RATE] __attribute__ ((aligned (16)));
 
+        unsigned int m_renormalized; //!< Amount subtracted from the path metrics to keep them in a byte
+
+        unsigned int m_path_metric; //!< Path metric of the last decoded block
+
         void viterbi_chainback(struct v *vp,
               unsigned char *data, /* Decoded output data */
               unsigned int nbits, /* Number of data bits */
@@ -125,6 +129,13 @@ namespace wno
          * \param data_bits The number of bits in the data input.
          */
         void conv_encode(unsigned char * data, unsigned char * symbols, int data_bits);
+
+        /*!
+         * \brief Gets the path metric of the survivor the last #conv_decode() traced back, i.e. the
+         *  accumulated branch metric of the decoded data against the received symbols. 0 means
+         *  every symbol agreed, higher means more (or less certain) symbols had to be corrected.
+         */
+        unsigned int path_metric() { return m_path_metric; }
     };
 
 }
@@ -0,0 +1,113 @@
+/*! \file window_stats.h
+ *  \brief Running statistics of a sliding window of complex samples.
+ *
+ *  This struct keeps the sum and the power (sum of squared magnitudes)
+ *  of the last size samples of a stream. Unlike the circular_accumulator
+ *  it does not store the samples itself, the caller passes in both the
+ *  sample entering and the sample leaving the window on each slide.
+ */
+
+#ifndef WINDOW_STATS_H
+#define WINDOW_STATS_H
+
+#include <complex>
+
+namespace wno
+{
+    /*!
+     * \brief The window_stats struct.
+     *
+     * Used to normalize sliding correlations in O(1) per sample. Since the
+     * sums are updated by adding and subtracting samples, rounding errors slowly
+     * accumulate. The sums are therefore recomputed from scratch every
+     * #refresh_interval slides using the window passed to #slide().
+     */
+    struct window_stats
+    {
+        /*!
+         * \brief Sum of the samples currently in the window
+         */
+        std::complex<double> sum;
+
+        /*!
+         * \brief Sum of the squared magnitudes of the samples currently in the window
+         */
+        double power;
+
+        /*!
+         * \brief Number of samples in the window
+         */
+        int size;
+
+        /*!
+         * \brief Number of slides between exact recomputations of #sum and #power
+         */
+        int refresh_interval;
+
+        /*!
+         * \brief Number of slides since the last exact recomputation
+         */
+        int slides;
+
+        /*!
+         * \brief Constructor for window_stats
+         * \param _size Number of samples in the window
+         * \param _refresh_interval Number of slides between exact recomputations
+         *
+         * Initializes the statistics to those of a window of zeros.
+         */
+        window_stats(int _size, int _refresh_interval = 1 << 20) :
+            sum(0, 0),
+            power(0),
+            size(_size),
+            refresh_interval(_refresh_interval),
+            slides(0)
+        {
+        }
+
+        /*!
+         * \brief Computes #sum and #power directly from the window.
+         * \param window Pointer to the first of #size contiguous samples.
+         */
+        void reset(const std::complex<double> * window)
+        {
+            sum = std::complex<double>(0, 0);
+            power = 0;
+            for(int x = 0; x < size; x++)
+            {
+                sum += window[x];
+                power += std::norm(window[x]);
+            }
+            slides = 0;
+        }
+
+        /*!
+         * \brief Slides the window forward by one sample.
+         * \param window Pointer to the first sample of the current window. The window
+         *  must be followed by one more contiguous sample which becomes the newest sample
+         *  of the window while window[0] drops out of it.
+         */
+        void slide(const std::complex<double> * window)
+        {
+            if(++slides == refresh_interval)
+            {
+                reset(window + 1);
+                return;
+            }
+            sum += window[size] - window[0];
+            power += std::norm(window[size]) - std::norm(window[0]);
+        }
+
+        /*!
+         * \brief Mean of the samples in the window
+         */
+        std::complex<double> mean() const { return sum / double(size); }
+
+        /*!
+         * \brief Power of the window with the mean removed, i.e. size times the variance
+         */
+        double centered_power() const { return power - std::norm(sum) / size; }
+    };
+}
+
+#endif // WINDOW_STATS_H
@@ -0,0 +1,154 @@
+/*! \file work_stealing_pool.cpp
+ *  \brief C++ file for the work_stealing_pool class.
+ *
+ *  The work_stealing_pool class runs independent tasks on a fixed set of worker
+ *  threads, e.g. the blocks of one or more receiver chains, with idle workers taking
+ *  over the tasks queued by busy ones.
+ */
+
+#include <algorithm>
+
+#include "work_stealing_pool.h"
+
+namespace wno
+{
+    static thread_local work_stealing_pool * t_pool = NULL; //!< Pool the current thread is a worker of
+    static thread_local int t_index = -1; //!< Index of the current thread in #t_pool
+
+    /*!
+     * Creates a task queue and a thread for each worker. The queues are all created
+     * before any thread starts so that the workers can steal from each other right away.
+     */
+    work_stealing_pool::work_stealing_pool(int num_threads) :
+        m_next_queue(0),
+        m_stop(false)
+    {
+        sem_init(&m_wake_sem, 0, 0);
+        for(int x = 0; x < num_threads; x++) m_queues.push_back(new worker_queue());
+        for(int x = 0; x < num_threads; x++) m_threads.push_back(std::thread(&work_stealing_pool::run_worker, this, x));
+    }
+
+    work_stealing_pool::~work_stealing_pool()
+    {
+        m_stop = true;
+        for(int x = 0; x < size(); x++) sem_post(&m_wake_sem);
+        for(int x = 0; x < size(); x++) m_threads[x].join();
+        for(int x = 0; x < m_queues.size(); x++) delete m_queues[x];
+        sem_destroy(&m_wake_sem);
+    }
+
+    int work_stealing_pool::current_index()
+    {
+        return (t_pool == this) ? t_index : -1;
+    }
+
+    void work_stealing_pool::submit(const std::function<void()> & task)
+    {
+        int index = current_index();
+        if(index < 0) index = m_next_queue.fetch_add(1) % m_queues.size();
+        {
+            std::lock_guard<std::mutex> guard(m_queues[index]->lock);
+            m_queues[index]->tasks.push_back(task);
+        }
+        sem_post(&m_wake_sem);
+    }
+
+    /*!
+     * Taking a task also takes the wake semaphore post that came with it (if it is still
+     * there) so that the posts do not pile up while the workers are busy.
+     */
+    bool work_stealing_pool::find_task(int index, std::function<void()> & task)
+    {
+        if(index >= 0)
+        {
+            std::lock_guard<std::mutex> guard(m_queues[index]->lock);
+            if(!m_queues[index]->tasks.empty())
+            {
+                task.swap(m_queues[index]->tasks.back());
+                m_queues[index]->tasks.pop_back();
+                sem_trywait(&m_wake_sem);
+                return true;
+            }
+        }
+
+        // Steal, starting with the next worker so that the thieves spread out
+        for(int x = 1; x <= m_queues.size(); x++)
+        {
+            int victim = (index + x + m_queues.size()) % m_queues.size();
+            if(victim == index) continue;
+            std::lock_guard<std::mutex> guard(m_queues[victim]->lock);
+            if(!m_queues[victim]->tasks.empty())
+            {
+                task.swap(m_queues[victim]->tasks.front());
+                m_queues[victim]->tasks.pop_front();
+                sem_trywait(&m_wake_sem);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /*!
+     * Every submitted task posts the wake semaphore once, so a worker only sleeps when
+     * every task submitted so far has been taken by some worker.
+     */
+    void work_stealing_pool::run_worker(int index)
+    {
+        t_pool = this;
+        t_index = index;
+        std::function<void()> task;
+        while(!m_stop)
+        {
+            if(find_task(index, task))
+            {
+                task();
+                task = NULL;
+                continue;
+            }
+            sem_wait(&m_wake_sem);
+        }
+    }
+
+    /*!
+     * Up to count - 1 helper tasks are queued, each claiming task indices until there are
+     * none left, and the calling thread claims indices as well. Helpers that start after
+     * all indices are claimed return right away. While the helpers are finishing the
+     * calling thread runs other queued tasks (its own helpers first when it is a worker).
+     */
+    void work_stealing_pool::parallel_for(int count, const std::function<void(int)> & task)
+    {
+        if(count <= 0) return;
+
+        std::atomic<int> next(0);
+        std::atomic<int> helpers_done(0);
+        std::function<void()> run = [&]()
+        {
+            int x;
+            while((x = next.fetch_add(1)) < count) task(x);
+        };
+
+        int helpers = std::min(count - 1, size());
+        for(int x = 0; x < helpers; x++)
+        {
+            submit([&]()
+            {
+                run();
+                helpers_done++;
+            });
+        }
+
+        run();
+
+        int index = current_index();
+        std::function<void()> other;
+        while(helpers_done.load() < helpers)
+        {
+            if(find_task(index, other))
+            {
+                other();
+                other = NULL;
+            }
+            else std::this_thread::yield();
+        }
+    }
+}
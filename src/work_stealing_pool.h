@@ -0,0 +1,105 @@
+/*! \file work_stealing_pool.h
+ *  \brief Header file for the work_stealing_pool class.
+ *
+ *  The work_stealing_pool class runs independent tasks on a fixed set of worker
+ *  threads, e.g. the blocks of one or more receiver chains, with idle workers taking
+ *  over the tasks queued by busy ones.
+ */
+
+#ifndef WORK_STEALING_POOL_H
+#define WORK_STEALING_POOL_H
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <semaphore.h>
+
+namespace wno
+{
+    /*!
+     * \brief The work_stealing_pool class.
+     *
+     * Every worker has its own task queue. A task submitted from a worker goes to the back
+     * of that worker's queue and the worker runs its own queue newest first, which keeps
+     * the data of related tasks in its cache. Tasks submitted from other threads are spread
+     * over the queues. A worker whose queue is empty steals the oldest task of another
+     * worker before going to sleep.
+     *
+     * #parallel_for() lets a task split data parallel work over the idle workers, the
+     * calling thread runs queued tasks while it waits so it never blocks a worker.
+     */
+    class work_stealing_pool
+    {
+    public:
+
+        /*!
+         * \brief Constructor for work_stealing_pool
+         * \param num_threads Number of worker threads.
+         */
+        work_stealing_pool(int num_threads);
+
+        /*!
+         * \brief Destructor for work_stealing_pool. Stops and joins the worker threads,
+         *  tasks still queued are not run.
+         */
+        ~work_stealing_pool();
+
+        /*!
+         * \brief Queues a task to run on one of the workers.
+         * \param task The task to run.
+         */
+        void submit(const std::function<void()> & task);
+
+        /*!
+         * \brief Runs task(0) .. task(count-1) on the idle workers and the calling thread.
+         * \param count Number of tasks to run.
+         * \param task Function to run for each task index.
+         */
+        void parallel_for(int count, const std::function<void(int)> & task);
+
+        int size() { return m_threads.size(); } //!< Get the number of worker threads
+
+    private:
+
+        /*!
+         * \brief Task queue of one worker
+         */
+        struct worker_queue
+        {
+            std::mutex lock;                            //!< Guards #tasks
+            std::deque<std::function<void()> > tasks;   //!< Queued tasks, the owner works at the back
+        };
+
+        /*!
+         * \brief Main loop for each worker thread. Runs tasks while there are any and
+         *  sleeps otherwise.
+         * \param index The worker's index.
+         */
+        void run_worker(int index);
+
+        /*!
+         * \brief Takes the newest task of a worker's own queue or else the oldest task of another queue.
+         * \param index Index of the worker looking for a task (-1 for other threads).
+         * \param task Set to the task found.
+         * \return False if every queue was empty.
+         */
+        bool find_task(int index, std::function<void()> & task);
+
+        int current_index(); //!< Index of the calling thread if it is a worker of this pool, -1 otherwise
+
+        std::vector<worker_queue *> m_queues; //!< One task queue per worker
+
+        std::vector<std::thread> m_threads; //!< The worker threads
+
+        sem_t m_wake_sem; //!< Posted for every submitted task to wake up a sleeping worker
+
+        std::atomic<unsigned int> m_next_queue; //!< Queue the next task from a non-worker thread goes to
+
+        std::atomic<bool> m_stop; //!< Tells the workers to exit
+    };
+}
+
+#endif // WORK_STEALING_POOL_H